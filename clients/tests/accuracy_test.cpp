@@ -116,7 +116,9 @@ void rocfft_transform(const std::vector<size_t>&            length,
                       const std::shared_future<fftw_data_t> cpu_input,
                       const std::shared_future<fftw_data_t> cpu_output,
                       const size_t                          ramgb,
-                      const std::shared_future<VectorNorms> cpu_output_norm)
+                      const std::shared_future<VectorNorms> cpu_output_norm,
+                      const size_t                          idist_pad,
+                      const size_t                          odist_pad)
 {
     if(ramgb > 0)
     {
@@ -248,8 +250,8 @@ void rocfft_transform(const std::vector<size_t>&            length,
                                       place == rocfft_placement_inplace
                                           && transformType == rocfft_transform_type_real_inverse);
 
-    const auto gpu_idist = set_idist(place, transformType, length, gpu_istride);
-    const auto gpu_odist = set_odist(place, transformType, length, gpu_ostride);
+    const auto gpu_idist = set_idist(place, transformType, length, gpu_istride) + idist_pad;
+    const auto gpu_odist = set_odist(place, transformType, length, gpu_ostride) + odist_pad;
 
     rocfft_status fft_status = rocfft_status_success;
     // Transform parameters from row-major to column-major for rocFFT:
@@ -33,6 +33,7 @@
 typedef std::vector<std::vector<char, fftwAllocator<char>>> fftw_data_t;
 
 // Compute the rocFFT transform and verify the accuracy against the provided CPU data.
+// idist_pad and odist_pad are added to the packed batch distances on the GPU.
 void rocfft_transform(const std::vector<size_t>&            length,
                       const std::vector<size_t>&            istride,
                       const std::vector<size_t>&            ostride,
@@ -51,7 +52,9 @@ void rocfft_transform(const std::vector<size_t>&            length,
                       const std::shared_future<fftw_data_t> cpu_input,
                       const std::shared_future<fftw_data_t> cpu_output,
                       const size_t                          ramgb,
-                      const std::shared_future<VectorNorms> cpu_output_norm);
+                      const std::shared_future<VectorNorms> cpu_output_norm,
+                      const size_t                          idist_pad = 0,
+                      const size_t                          odist_pad = 0);
 
 // Print the test parameters
 inline void print_params(const std::vector<size_t>&    length,
@@ -42,10 +42,11 @@ static std::vector<size_t> pow3_range
 static std::vector<size_t> pow5_range
     = {5, 25, 125, 625, 3125, 15625, 78125, 390625, 1953125, 9765625, 48828125};
 // radix 7 sizes that are either pure pow7 or sizes people have wanted in the wild
-static std::vector<size_t> pow7_range = {7, 49, 84, 112};
+static std::vector<size_t> pow7_range = {7, 49, 84, 112, 343, 1344, 2401, 3780, 28672, 100352};
 static std::vector<size_t> mix_range
-    = {6,   10,   12,   15,   20,   30,   120,  150,  225,  240,  300,   486,   600,
-       900, 1250, 1500, 1875, 2160, 2187, 2250, 2500, 3000, 4000, 12000, 24000, 72000};
+    = {6,    10,   12,    15,    20,    30,   48,   120,  144,  150,  225,  240,  300,
+       432,  486,  600,   900,   1250,  1500, 1728, 1875, 2160, 2187, 2250, 2500, 3000,
+       3456, 4000, 12000, 24000, 40000, 72000, 82944};
 static std::vector<size_t> prime_range
     = {7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47, 53, 59, 61, 67, 71, 73, 79, 83, 89, 97};
 
@@ -201,7 +202,7 @@ INSTANTIATE_TEST_SUITE_P(
     accuracy_test,
     ::testing::Combine(ValuesIn(generate_lengths(vpow7_range)),
                        ValuesIn(precision_range),
-                       ValuesIn(batch_range),
+                       ValuesIn(batch_range_1D),
                        ValuesIn(stride_range),
                        ValuesIn(stride_range),
                        ValuesIn(generate_types(rocfft_transform_type_complex_forward,
@@ -211,7 +212,7 @@ INSTANTIATE_TEST_SUITE_P(
     accuracy_test,
     ::testing::Combine(ValuesIn(generate_lengths(vpow7_range)),
                        ValuesIn(precision_range),
-                       ValuesIn(batch_range),
+                       ValuesIn(batch_range_1D),
                        ValuesIn(stride_range),
                        ValuesIn(stride_range),
                        ValuesIn(generate_types(rocfft_transform_type_complex_inverse,
@@ -221,7 +222,7 @@ INSTANTIATE_TEST_SUITE_P(
     accuracy_test,
     ::testing::Combine(ValuesIn(generate_lengths(vpow7_range)),
                        ValuesIn(precision_range),
-                       ValuesIn(batch_range),
+                       ValuesIn(batch_range_1D),
                        ValuesIn(stride_range),
                        ValuesIn(stride_range),
                        ValuesIn(generate_types(rocfft_transform_type_real_forward, place_range))));
@@ -230,7 +231,7 @@ INSTANTIATE_TEST_SUITE_P(
     accuracy_test,
     ::testing::Combine(ValuesIn(generate_lengths(vpow7_range)),
                        ValuesIn(precision_range),
-                       ValuesIn(batch_range),
+                       ValuesIn(batch_range_1D),
                        ValuesIn(stride_range),
                        ValuesIn(stride_range),
                        ValuesIn(generate_types(rocfft_transform_type_real_inverse, place_range))));
@@ -336,3 +337,128 @@ INSTANTIATE_TEST_SUITE_P(
                        ValuesIn(stride_range_for_pow2),
                        ValuesIn(generate_types(rocfft_transform_type_complex_forward,
                                                place_range))));
+
+// Odd lengths without a fused real kernel use the paired real/complex
+// algorithm for even batches.  In double precision these lengths are
+// above the single kernel threshold, so only single precision is
+// tested.
+static std::vector<std::vector<size_t>>    pair_range           = {{2835}, {3125}, {3969}};
+const static std::vector<size_t>           batch_range_pair     = {2, 4};
+const static std::vector<rocfft_precision> precision_range_pair = {rocfft_precision_single};
+INSTANTIATE_TEST_SUITE_P(
+    pair_1D_real_forward,
+    accuracy_test,
+    ::testing::Combine(ValuesIn(pair_range),
+                       ValuesIn(precision_range_pair),
+                       ValuesIn(batch_range_pair),
+                       ValuesIn(stride_range),
+                       ValuesIn(stride_range),
+                       ValuesIn(generate_types(rocfft_transform_type_real_forward, place_range))));
+INSTANTIATE_TEST_SUITE_P(
+    pair_1D_real_inverse,
+    accuracy_test,
+    ::testing::Combine(ValuesIn(pair_range),
+                       ValuesIn(precision_range_pair),
+                       ValuesIn(batch_range_pair),
+                       ValuesIn(stride_range),
+                       ValuesIn(stride_range),
+                       ValuesIn(generate_types(rocfft_transform_type_real_inverse, place_range))));
+
+// Odd lengths that fit in one threadblock run as a single fused real
+// kernel
+static std::vector<std::vector<size_t>> odd_real_range = {{21}, {45}, {105}, {315}, {1029}, {1715}};
+INSTANTIATE_TEST_SUITE_P(
+    odd_1D_real_forward,
+    accuracy_test,
+    ::testing::Combine(ValuesIn(odd_real_range),
+                       ValuesIn(precision_range),
+                       ValuesIn(batch_range_1D),
+                       ValuesIn(stride_range),
+                       ValuesIn(stride_range),
+                       ValuesIn(generate_types(rocfft_transform_type_real_forward, place_range))));
+INSTANTIATE_TEST_SUITE_P(
+    odd_1D_real_inverse,
+    accuracy_test,
+    ::testing::Combine(ValuesIn(odd_real_range),
+                       ValuesIn(precision_range),
+                       ValuesIn(batch_range_1D),
+                       ValuesIn(stride_range),
+                       ValuesIn(stride_range),
+                       ValuesIn(generate_types(rocfft_transform_type_real_inverse, place_range))));
+
+// Even-length real transforms with non-unit strides do their pre- and
+// post-processing directly on the strided data.  In-place real
+// transforms need unit strides, so only out-of-place is tested.
+static std::vector<std::vector<size_t>> even_real_range_for_stride = {{8}, {64}, {200}, {1000}};
+static std::vector<std::vector<size_t>> stride_range_for_real      = {{2}, {3}};
+const static std::vector<rocfft_result_placement> place_range_notinplace
+    = {rocfft_placement_notinplace};
+INSTANTIATE_TEST_SUITE_P(
+    even_1D_real_forward_stride,
+    accuracy_test,
+    ::testing::Combine(ValuesIn(even_real_range_for_stride),
+                       ValuesIn(precision_range),
+                       ValuesIn(batch_range_1D),
+                       ValuesIn(stride_range_for_real),
+                       ValuesIn(stride_range_for_real),
+                       ValuesIn(generate_types(rocfft_transform_type_real_forward,
+                                               place_range_notinplace))));
+INSTANTIATE_TEST_SUITE_P(
+    even_1D_real_inverse_stride,
+    accuracy_test,
+    ::testing::Combine(ValuesIn(even_real_range_for_stride),
+                       ValuesIn(precision_range),
+                       ValuesIn(batch_range_1D),
+                       ValuesIn(stride_range_for_real),
+                       ValuesIn(stride_range_for_real),
+                       ValuesIn(generate_types(rocfft_transform_type_real_inverse,
+                                               place_range_notinplace))));
+
+// The same strided even-length real transforms, with padding between
+// batches so that the distances are not packed.
+TEST(accuracy_test_1D_dist, even_real_stride_padded_dist)
+{
+    const std::vector<size_t> dist_pads = {1, 7};
+    for(auto transformType :
+        {rocfft_transform_type_real_forward, rocfft_transform_type_real_inverse})
+    {
+        for(const auto& length : even_real_range_for_stride)
+        {
+            for(auto precision : precision_range)
+            {
+                const size_t nbatch = 3;
+                auto cpu = accuracy_test::compute_cpu_fft(length, nbatch, precision, transformType);
+                for(const auto& stride : stride_range_for_real)
+                {
+                    for(auto pad : dist_pads)
+                    {
+                        for(const auto& io : generate_types(transformType, place_range_notinplace))
+                        {
+                            rocfft_transform(length,
+                                             stride,
+                                             stride,
+                                             nbatch,
+                                             precision,
+                                             transformType,
+                                             std::get<2>(io),
+                                             std::get<3>(io),
+                                             rocfft_placement_notinplace,
+                                             cpu.istride,
+                                             cpu.ostride,
+                                             cpu.idist,
+                                             cpu.odist,
+                                             cpu.itype,
+                                             cpu.otype,
+                                             cpu.input,
+                                             cpu.output,
+                                             ramgb,
+                                             cpu.output_norm,
+                                             pad,
+                                             pad + 2);
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
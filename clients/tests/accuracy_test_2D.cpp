@@ -331,3 +331,28 @@ INSTANTIATE_TEST_SUITE_P(
                        ValuesIn(stride_range),
                        ValuesIn(stride_range),
                        ValuesIn(generate_types(rocfft_transform_type_real_inverse, place_range))));
+
+// Small 2D real transforms with an even fastest dimension run as a
+// single fused kernel
+static std::vector<std::vector<size_t>> single_real_range
+    = {{64, 64}, {81, 50}, {8, 486}, {243, 18}};
+const static std::vector<rocfft_precision> precision_range_single_real
+    = {rocfft_precision_single};
+INSTANTIATE_TEST_SUITE_P(
+    single_2D_real_forward,
+    accuracy_test,
+    ::testing::Combine(ValuesIn(single_real_range),
+                       ValuesIn(precision_range_single_real),
+                       ValuesIn(batch_range),
+                       ValuesIn(stride_range),
+                       ValuesIn(stride_range),
+                       ValuesIn(generate_types(rocfft_transform_type_real_forward, place_range))));
+INSTANTIATE_TEST_SUITE_P(
+    single_2D_real_inverse,
+    accuracy_test,
+    ::testing::Combine(ValuesIn(single_real_range),
+                       ValuesIn(precision_range_single_real),
+                       ValuesIn(batch_range),
+                       ValuesIn(stride_range),
+                       ValuesIn(stride_range),
+                       ValuesIn(generate_types(rocfft_transform_type_real_inverse, place_range))));
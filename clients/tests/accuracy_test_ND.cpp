@@ -0,0 +1,88 @@
+// Copyright (c) 2016 - present Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+#include "../client_utils.h"
+
+#include "accuracy_test.h"
+#include "fftw_transform.h"
+#include "rocfft.h"
+#include "rocfft_against_fftw.h"
+
+
+using ::testing::ValuesIn;
+
+// Ranks above three are built from an (N-1)-D transform, a transpose
+// of the slowest dimension, a 1D transform and a transpose back.
+// Lengths are row-major, so the first length is the slowest
+// dimension.
+static std::vector<std::vector<size_t>> rank4_range = {{2, 4, 8, 16}, {3, 5, 4, 8}, {16, 2, 3, 4}};
+static std::vector<std::vector<size_t>> rank5_range = {{3, 5, 4, 8, 2}, {2, 3, 4, 5, 6}};
+
+const static std::vector<size_t> batch_range_ND = {2, 3};
+
+// The innermost stride; compute_stride fills in the rest, so strides
+// above one leave gaps between rows and batches.
+static std::vector<std::vector<size_t>> stride_range_ND = {{1}, {2}, {3}};
+
+INSTANTIATE_TEST_SUITE_P(
+    rank4_complex_forward,
+    accuracy_test,
+    ::testing::Combine(ValuesIn(rank4_range),
+                       ValuesIn(precision_range),
+                       ValuesIn(batch_range_ND),
+                       ValuesIn(stride_range_ND),
+                       ValuesIn(stride_range_ND),
+                       ValuesIn(generate_types(rocfft_transform_type_complex_forward,
+                                               place_range))));
+INSTANTIATE_TEST_SUITE_P(
+    rank4_complex_inverse,
+    accuracy_test,
+    ::testing::Combine(ValuesIn(rank4_range),
+                       ValuesIn(precision_range),
+                       ValuesIn(batch_range_ND),
+                       ValuesIn(stride_range_ND),
+                       ValuesIn(stride_range_ND),
+                       ValuesIn(generate_types(rocfft_transform_type_complex_inverse,
+                                               place_range))));
+INSTANTIATE_TEST_SUITE_P(
+    rank5_complex_forward,
+    accuracy_test,
+    ::testing::Combine(ValuesIn(rank5_range),
+                       ValuesIn(precision_range),
+                       ValuesIn(batch_range_ND),
+                       ValuesIn(stride_range_ND),
+                       ValuesIn(stride_range_ND),
+                       ValuesIn(generate_types(rocfft_transform_type_complex_forward,
+                                               place_range))));
+INSTANTIATE_TEST_SUITE_P(
+    rank5_complex_inverse,
+    accuracy_test,
+    ::testing::Combine(ValuesIn(rank5_range),
+                       ValuesIn(precision_range),
+                       ValuesIn(batch_range_ND),
+                       ValuesIn(stride_range_ND),
+                       ValuesIn(stride_range_ND),
+                       ValuesIn(generate_types(rocfft_transform_type_complex_inverse,
+                                               place_range))));
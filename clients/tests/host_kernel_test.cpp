@@ -0,0 +1,216 @@
+// Copyright (c) 2016 - present Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Host versions of the generated Stockham kernels, checked against
+// FFTW.  These run without a GPU, so every generated length is
+// covered even on machines that can't run the device kernels.
+
+#include "rocfft_host_kernels.h"
+#include <cmath>
+#include <complex>
+#include <fftw3.h>
+#include <gtest/gtest.h>
+#include <random>
+#include <utility>
+#include <vector>
+
+template <typename T>
+static void host_kernel_vs_fftw(double tolerance)
+{
+    const size_t batch      = 3;
+    const size_t stride     = 2;
+    const int    directions = 2;
+
+    for(const auto& kernel : host_kernels<T>())
+    {
+        SCOPED_TRACE("length " + std::to_string(kernel.length));
+
+        const size_t N    = kernel.length;
+        const size_t dist = N * stride + 1;
+
+        std::vector<T>                    input(batch * dist);
+        std::vector<T>                    output(batch * dist);
+        std::vector<std::complex<double>> ref_in(N), ref_out(N);
+
+        std::mt19937                           gen(N);
+        std::uniform_real_distribution<double> dis(-0.5, 0.5);
+        for(auto& v : input)
+            v = lib_make_vector2<T>(dis(gen), dis(gen));
+
+        const auto twiddles = host_kernel_twiddles<T>(kernel.radices);
+
+        for(int d = 0; d < directions; ++d)
+        {
+            const bool fwd = (d == 0);
+            (fwd ? kernel.fwd : kernel.back)(twiddles.data(),
+                                             batch,
+                                             input.data(),
+                                             stride,
+                                             dist,
+                                             output.data(),
+                                             stride,
+                                             dist);
+
+            fftw_plan p = fftw_plan_dft_1d(N,
+                                           reinterpret_cast<fftw_complex*>(ref_in.data()),
+                                           reinterpret_cast<fftw_complex*>(ref_out.data()),
+                                           fwd ? FFTW_FORWARD : FFTW_BACKWARD,
+                                           FFTW_ESTIMATE);
+            for(size_t b = 0; b < batch; ++b)
+            {
+                for(size_t i = 0; i < N; ++i)
+                {
+                    const T& v = input[b * dist + i * stride];
+                    ref_in[i]  = std::complex<double>(v.x, v.y);
+                }
+                fftw_execute(p);
+
+                double diff = 0.0;
+                double norm = 0.0;
+                for(size_t i = 0; i < N; ++i)
+                {
+                    const T& v = output[b * dist + i * stride];
+                    diff += std::norm(ref_out[i] - std::complex<double>(v.x, v.y));
+                    norm += std::norm(ref_out[i]);
+                }
+                EXPECT_LE(std::sqrt(diff / norm), tolerance) << (fwd ? "forward" : "backward");
+            }
+            fftw_destroy_plan(p);
+        }
+    }
+}
+
+TEST(rocfft_HostKernelTest, single_vs_fftw)
+{
+    host_kernel_vs_fftw<float2>(1e-5);
+}
+
+TEST(rocfft_HostKernelTest, double_vs_fftw)
+{
+    host_kernel_vs_fftw<double2>(1e-12);
+}
+
+// Pass the registers to a butterfly in order, as the generated
+// kernels do.
+template <typename T, typename F, size_t... I>
+static void call_butterfly(F butterfly, T* R, std::index_sequence<I...>)
+{
+    butterfly((R + I)...);
+}
+
+#define CALL_BUTTERFLY(N)                                                              \
+    call_butterfly(fwd ? FwdRad##N##B1<T> : InvRad##N##B1<T>, R, std::make_index_sequence<N>())
+
+template <typename T>
+static void butterfly(size_t radix, bool fwd, T* R)
+{
+    switch(radix)
+    {
+    case 2:
+        CALL_BUTTERFLY(2);
+        break;
+    case 3:
+        CALL_BUTTERFLY(3);
+        break;
+    case 4:
+        CALL_BUTTERFLY(4);
+        break;
+    case 5:
+        CALL_BUTTERFLY(5);
+        break;
+    case 6:
+        CALL_BUTTERFLY(6);
+        break;
+    case 7:
+        CALL_BUTTERFLY(7);
+        break;
+    case 8:
+        CALL_BUTTERFLY(8);
+        break;
+    case 9:
+        CALL_BUTTERFLY(9);
+        break;
+    case 10:
+        CALL_BUTTERFLY(10);
+        break;
+    case 11:
+        CALL_BUTTERFLY(11);
+        break;
+    case 12:
+        CALL_BUTTERFLY(12);
+        break;
+    case 13:
+        CALL_BUTTERFLY(13);
+        break;
+    case 16:
+        CALL_BUTTERFLY(16);
+        break;
+    default:
+        FAIL() << "no butterfly for radix " << radix;
+    }
+}
+
+// Each butterfly is a DFT of its radix, leaving its output in natural
+// order in the registers.
+template <typename T>
+static void butterfly_vs_dft(double tolerance)
+{
+    const double TWO_PI = 6.283185307179586476925286766559;
+
+    std::mt19937                           gen(0);
+    std::uniform_real_distribution<double> dis(-0.5, 0.5);
+
+    for(size_t radix : {2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 16})
+    {
+        for(bool fwd : {true, false})
+        {
+            SCOPED_TRACE(std::string(fwd ? "forward" : "backward") + " radix "
+                         + std::to_string(radix));
+
+            std::vector<T> R(radix);
+            for(auto& v : R)
+                v = lib_make_vector2<T>(dis(gen), dis(gen));
+            const auto input = R;
+
+            butterfly(radix, fwd, R.data());
+
+            const double sign = fwd ? -1.0 : 1.0;
+            for(size_t k = 0; k < radix; ++k)
+            {
+                std::complex<double> ref = 0.0;
+                for(size_t j = 0; j < radix; ++j)
+                    ref += std::complex<double>(input[j].x, input[j].y)
+                           * std::polar(1.0, sign * TWO_PI * ((j * k) % radix) / radix);
+                EXPECT_NEAR(R[k].x, ref.real(), tolerance) << "output " << k;
+                EXPECT_NEAR(R[k].y, ref.imag(), tolerance) << "output " << k;
+            }
+        }
+    }
+}
+
+TEST(rocfft_HostKernelTest, single_butterfly_vs_dft)
+{
+    butterfly_vs_dft<float2>(1e-5);
+}
+
+TEST(rocfft_HostKernelTest, double_butterfly_vs_dft)
+{
+    butterfly_vs_dft<double2>(1e-13);
+}
@@ -19,11 +19,14 @@
 // THE SOFTWARE.
 
 #include "gpubuf.h"
+#include "hip/hip_runtime.h"
 #include "hip/hip_runtime_api.h"
 #include "hip/hip_vector_types.h"
 #include "private.h"
 #include "rocfft.h"
+#include <algorithm>
 #include <boost/scope_exit.hpp>
+#include <cmath>
 #include <condition_variable>
 #include <fstream>
 #include <gtest/gtest.h>
@@ -360,3 +363,767 @@ TEST(rocfft_UnitTest, workmem_null)
     workmem_test(
         [](size_t requested) { return requested; }, rocfft_status_invalid_work_buffer, true);
 }
+
+// Kernel schemes a plan runs, separated by spaces
+static std::string plan_kernel_schemes(rocfft_plan plan)
+{
+    std::vector<char> buf(4096);
+    EXPECT_EQ(rocfft_plan_get_kernel_schemes(plan, buf.data(), buf.size()),
+              rocfft_status_success);
+    return buf.data();
+}
+
+// Whether a plan of the given type and lengths runs a kernel of the
+// given scheme
+static bool plan_uses_scheme(rocfft_transform_type transform_type,
+                             rocfft_precision      precision,
+                             std::vector<size_t>   lengths,
+                             size_t                batch,
+                             const std::string&    scheme)
+{
+    rocfft_plan plan = nullptr;
+    EXPECT_EQ(rocfft_plan_create(&plan,
+                                 rocfft_placement_notinplace,
+                                 transform_type,
+                                 precision,
+                                 lengths.size(),
+                                 lengths.data(),
+                                 batch,
+                                 nullptr),
+              rocfft_status_success);
+    auto schemes = plan_kernel_schemes(plan);
+    rocfft_plan_destroy(plan);
+    // match whole scheme names
+    return (" " + schemes + " ").find(" " + scheme + " ") != std::string::npos;
+}
+
+// odd lengths without a fused real kernel use the paired algorithm
+// for even batches, in both directions
+TEST(rocfft_UnitTest, real_pair_scheme)
+{
+    rocfft_setup();
+    for(size_t length : {2835, 3125, 3969})
+    {
+        EXPECT_TRUE(plan_uses_scheme(rocfft_transform_type_real_forward,
+                                     rocfft_precision_single,
+                                     {length},
+                                     2,
+                                     "CS_KERNEL_PAIR_UNPACK"));
+        EXPECT_TRUE(plan_uses_scheme(rocfft_transform_type_real_inverse,
+                                     rocfft_precision_single,
+                                     {length},
+                                     2,
+                                     "CS_KERNEL_PAIR_PACK"));
+        EXPECT_FALSE(plan_uses_scheme(rocfft_transform_type_real_inverse,
+                                      rocfft_precision_single,
+                                      {length},
+                                      1,
+                                      "CS_KERNEL_PAIR_PACK"));
+    }
+    rocfft_cleanup();
+}
+
+// odd lengths that fit in one threadblock run as a single fused
+// real kernel
+TEST(rocfft_UnitTest, real_odd_fused_scheme)
+{
+    rocfft_setup();
+    for(auto precision : {rocfft_precision_single, rocfft_precision_double})
+    {
+        for(size_t length : {21, 45, 105, 315, 1029, 1715})
+        {
+            EXPECT_TRUE(plan_uses_scheme(rocfft_transform_type_real_forward,
+                                         precision,
+                                         {length},
+                                         1,
+                                         "CS_KERNEL_STOCKHAM_REAL"));
+            EXPECT_TRUE(plan_uses_scheme(rocfft_transform_type_real_inverse,
+                                         precision,
+                                         {length},
+                                         1,
+                                         "CS_KERNEL_STOCKHAM_REAL"));
+        }
+    }
+    rocfft_cleanup();
+}
+
+// small 2D real transforms with an even fastest dimension run as a
+// single fused kernel
+TEST(rocfft_UnitTest, real_2D_single_scheme)
+{
+    rocfft_setup();
+    const std::vector<std::vector<size_t>> lengths = {{64, 64}, {50, 81}, {486, 8}, {18, 243}};
+    for(const auto& length : lengths)
+    {
+        EXPECT_TRUE(plan_uses_scheme(rocfft_transform_type_real_forward,
+                                     rocfft_precision_single,
+                                     length,
+                                     1,
+                                     "CS_KERNEL_2D_SINGLE_REAL"));
+        EXPECT_TRUE(plan_uses_scheme(rocfft_transform_type_real_inverse,
+                                     rocfft_precision_single,
+                                     length,
+                                     1,
+                                     "CS_KERNEL_2D_SINGLE_REAL"));
+    }
+    rocfft_cleanup();
+}
+
+// Single-precision interleaved complex data for tests that run plans
+// and compare their outputs.  The input is filled with a repeating
+// pattern and copied to the device.  Out-of-place data also gets an
+// output buffer of the same size.
+struct complex_test_data
+{
+    complex_test_data(size_t                  elements,
+                      rocfft_result_placement placement = rocfft_placement_notinplace,
+                      size_t                  modulus   = 13)
+        : host(elements * 2)
+        , bytes(host.size() * sizeof(float))
+    {
+        for(size_t i = 0; i < host.size(); ++i)
+            host[i] = static_cast<float>(i % modulus);
+        EXPECT_EQ(in.alloc(bytes), hipSuccess);
+        EXPECT_EQ(hipMemcpy(in.data(), host.data(), bytes, hipMemcpyHostToDevice), hipSuccess);
+        in_ptr = in.data();
+        if(placement == rocfft_placement_notinplace)
+        {
+            EXPECT_EQ(out.alloc(bytes), hipSuccess);
+            out_ptr = out.data();
+        }
+    }
+
+    // Execute a plan on these buffers, in place if there is no output
+    // buffer
+    rocfft_status execute(rocfft_plan plan, rocfft_execution_info info = nullptr)
+    {
+        return rocfft_execute(plan, &in_ptr, out_ptr ? &out_ptr : nullptr, info);
+    }
+
+    // Host copy of the output, which is the input buffer for in-place
+    // data
+    std::vector<float> output()
+    {
+        std::vector<float> result(host.size());
+        EXPECT_EQ(
+            hipMemcpy(result.data(), out_ptr ? out_ptr : in_ptr, bytes, hipMemcpyDeviceToHost),
+            hipSuccess);
+        return result;
+    }
+
+    // Clear the output buffer, execute a plan and fetch its output
+    std::vector<float> run(rocfft_plan plan, rocfft_execution_info info = nullptr)
+    {
+        if(out_ptr)
+            hipMemset(out_ptr, 0, bytes);
+        EXPECT_EQ(execute(plan, info), rocfft_status_success);
+        return output();
+    }
+
+    std::vector<float> host;
+    size_t             bytes;
+    gpubuf             in;
+    gpubuf             out;
+    void*              in_ptr  = nullptr;
+    void*              out_ptr = nullptr;
+};
+
+// check that execution records one completion event, or one event
+// per kernel when asked, and that blocking mode waits for them
+TEST(rocfft_UnitTest, execution_events)
+{
+    rocfft_setup();
+
+    // same length as the workmem tests, so the plan has several kernels
+    size_t      length = 8192;
+    rocfft_plan plan   = NULL;
+
+    ASSERT_EQ(rocfft_plan_create(&plan,
+                                 rocfft_placement_inplace,
+                                 rocfft_transform_type_complex_forward,
+                                 rocfft_precision_single,
+                                 1,
+                                 &length,
+                                 1,
+                                 nullptr),
+              rocfft_status_success);
+
+    size_t work_size = 0;
+    ASSERT_EQ(rocfft_plan_get_work_buffer_size(plan, &work_size), rocfft_status_success);
+    gpubuf work_buffer;
+    ASSERT_EQ(work_buffer.alloc(work_size), hipSuccess);
+
+    hipStream_t stream = nullptr;
+    ASSERT_EQ(hipStreamCreate(&stream), hipSuccess);
+
+    rocfft_execution_info info;
+    ASSERT_EQ(rocfft_execution_info_create(&info), rocfft_status_success);
+    ASSERT_EQ(rocfft_execution_info_set_work_buffer(info, work_buffer.data(), work_size),
+              rocfft_status_success);
+    ASSERT_EQ(rocfft_execution_info_set_stream(info, stream), rocfft_status_success);
+
+    // nothing executed yet
+    size_t num_events = 1;
+    ASSERT_EQ(rocfft_execution_info_get_events(info, nullptr, &num_events),
+              rocfft_status_success);
+    EXPECT_EQ(num_events, 0);
+
+    complex_test_data data(length, rocfft_placement_inplace);
+    ASSERT_EQ(data.execute(plan, info), rocfft_status_success);
+    ASSERT_EQ(rocfft_execution_info_get_events(info, nullptr, &num_events),
+              rocfft_status_success);
+    EXPECT_EQ(num_events, 1);
+    void* plan_event = nullptr;
+    ASSERT_EQ(rocfft_execution_info_get_events(info, &plan_event, &num_events),
+              rocfft_status_success);
+    EXPECT_EQ(hipEventSynchronize(static_cast<hipEvent_t>(plan_event)), hipSuccess);
+
+    // per-kernel events, waited for by rocfft_execute itself
+    ASSERT_EQ(rocfft_execution_info_set_kernel_events(info, 1), rocfft_status_success);
+    ASSERT_EQ(rocfft_execution_info_set_mode(info, rocfft_exec_mode_blocking),
+              rocfft_status_success);
+    ASSERT_EQ(data.execute(plan, info), rocfft_status_success);
+    ASSERT_EQ(rocfft_execution_info_get_events(info, nullptr, &num_events),
+              rocfft_status_success);
+    EXPECT_GT(num_events, 1);
+    std::vector<void*> kernel_events(num_events);
+    ASSERT_EQ(rocfft_execution_info_get_events(info, kernel_events.data(), &num_events),
+              rocfft_status_success);
+    for(auto event : kernel_events)
+        EXPECT_EQ(hipEventQuery(static_cast<hipEvent_t>(event)), hipSuccess);
+
+    rocfft_execution_info_destroy(info);
+    hipStreamDestroy(stream);
+    rocfft_plan_destroy(plan);
+    rocfft_cleanup();
+}
+
+// check that launch graphs give the same results as direct launches.
+// A stream and set of buffers runs directly, is then captured and is
+// then replayed; other buffers and the null stream must not disturb
+// the recorded graph.
+TEST(rocfft_UnitTest, launch_graph)
+{
+    rocfft_setup();
+
+    // several kernels, and a work buffer
+    size_t      length = 8192;
+    rocfft_plan plan   = NULL;
+    ASSERT_EQ(rocfft_plan_create(&plan,
+                                 rocfft_placement_notinplace,
+                                 rocfft_transform_type_complex_forward,
+                                 rocfft_precision_single,
+                                 1,
+                                 &length,
+                                 1,
+                                 nullptr),
+              rocfft_status_success);
+
+    size_t work_size = 0;
+    ASSERT_EQ(rocfft_plan_get_work_buffer_size(plan, &work_size), rocfft_status_success);
+    gpubuf work_buffer;
+    ASSERT_EQ(work_buffer.alloc(work_size), hipSuccess);
+
+    // expected result, launched directly on the null stream
+    complex_test_data data(length);
+    auto              expected = data.run(plan);
+
+    hipStream_t stream = nullptr;
+    ASSERT_EQ(hipStreamCreate(&stream), hipSuccess);
+    rocfft_execution_info info;
+    ASSERT_EQ(rocfft_execution_info_create(&info), rocfft_status_success);
+    ASSERT_EQ(rocfft_execution_info_set_work_buffer(info, work_buffer.data(), work_size),
+              rocfft_status_success);
+    ASSERT_EQ(rocfft_execution_info_set_stream(info, stream), rocfft_status_success);
+    ASSERT_EQ(rocfft_execution_info_set_launch_graph(info, 1), rocfft_status_success);
+
+    // direct, captured, replayed
+    for(int i = 0; i < 3; ++i)
+        EXPECT_EQ(data.run(plan, info), expected);
+
+    // other buffers are keyed separately; the recorded graph is
+    // still replayed afterwards
+    complex_test_data other(length);
+    for(int i = 0; i < 3; ++i)
+        EXPECT_EQ(other.run(plan, info), expected);
+    EXPECT_EQ(data.run(plan, info), expected);
+
+    // the null stream always launches directly
+    ASSERT_EQ(rocfft_execution_info_set_stream(info, nullptr), rocfft_status_success);
+    EXPECT_EQ(data.run(plan, info), expected);
+
+    rocfft_execution_info_destroy(info);
+    hipStreamDestroy(stream);
+    rocfft_plan_destroy(plan);
+    rocfft_cleanup();
+}
+
+// check that executions without a work buffer can use the pool, and
+// that trimming releases its memory
+TEST(rocfft_UnitTest, workmem_pool)
+{
+    rocfft_setup();
+
+    size_t      length = 8192;
+    rocfft_plan plan   = NULL;
+
+    ASSERT_EQ(rocfft_plan_create(&plan,
+                                 rocfft_placement_inplace,
+                                 rocfft_transform_type_complex_forward,
+                                 rocfft_precision_single,
+                                 1,
+                                 &length,
+                                 1,
+                                 nullptr),
+              rocfft_status_success);
+
+    size_t requested_work_size = 0;
+    ASSERT_EQ(rocfft_plan_get_work_buffer_size(plan, &requested_work_size), rocfft_status_success);
+    ASSERT_GT(requested_work_size, 0);
+
+    rocfft_execution_info info;
+    ASSERT_EQ(rocfft_execution_info_create(&info), rocfft_status_success);
+    ASSERT_EQ(rocfft_execution_info_set_work_buffer_pool(info, 1), rocfft_status_success);
+
+    complex_test_data data(length, rocfft_placement_inplace);
+
+    // repeated executions on the same stream reuse one block
+    size_t pool_bytes       = 0;
+    size_t high_water_bytes = 0;
+    for(int i = 0; i < 3; ++i)
+    {
+        ASSERT_EQ(data.execute(plan, info), rocfft_status_success);
+        ASSERT_EQ(rocfft_work_buffer_pool_get_usage(&pool_bytes, &high_water_bytes),
+                  rocfft_status_success);
+        EXPECT_GE(pool_bytes, requested_work_size);
+        EXPECT_EQ(pool_bytes, high_water_bytes);
+    }
+    hipDeviceSynchronize();
+
+    ASSERT_EQ(rocfft_work_buffer_pool_trim(), rocfft_status_success);
+    ASSERT_EQ(rocfft_work_buffer_pool_get_usage(&pool_bytes, &high_water_bytes),
+              rocfft_status_success);
+    EXPECT_EQ(pool_bytes, 0);
+    EXPECT_GE(high_water_bytes, requested_work_size);
+
+    rocfft_execution_info_destroy(info);
+    rocfft_plan_destroy(plan);
+    rocfft_cleanup();
+}
+
+// check that executing several plans at once gives the same results
+// as executing them one at a time
+TEST(rocfft_UnitTest, execute_many)
+{
+    rocfft_setup();
+
+    // the larger length needs a work buffer, the smaller does not
+    std::vector<size_t>      lengths = {64, 8192, 64};
+    std::vector<rocfft_plan> plans;
+    size_t                   work_size = 0;
+    for(auto length : lengths)
+    {
+        rocfft_plan plan = NULL;
+        ASSERT_EQ(rocfft_plan_create(&plan,
+                                     rocfft_placement_notinplace,
+                                     rocfft_transform_type_complex_forward,
+                                     rocfft_precision_single,
+                                     1,
+                                     &length,
+                                     1,
+                                     nullptr),
+                  rocfft_status_success);
+        size_t plan_work_size = 0;
+        ASSERT_EQ(rocfft_plan_get_work_buffer_size(plan, &plan_work_size), rocfft_status_success);
+        work_size = std::max(work_size, plan_work_size);
+        plans.push_back(plan);
+    }
+
+    gpubuf work_buffer;
+    ASSERT_EQ(work_buffer.alloc(work_size), hipSuccess);
+    rocfft_execution_info info;
+    ASSERT_EQ(rocfft_execution_info_create(&info), rocfft_status_success);
+    ASSERT_EQ(rocfft_execution_info_set_work_buffer(info, work_buffer.data(), work_size),
+              rocfft_status_success);
+
+    std::vector<complex_test_data> data;
+    for(size_t i = 0; i < lengths.size(); ++i)
+        data.emplace_back(lengths[i], rocfft_placement_notinplace, 13 + i);
+
+    // expected results, one plan at a time
+    std::vector<std::vector<float>> expected;
+    for(size_t i = 0; i < lengths.size(); ++i)
+    {
+        expected.push_back(data[i].run(plans[i], info));
+        hipMemset(data[i].out_ptr, 0, data[i].bytes);
+    }
+
+    std::vector<void**> in_arrays;
+    std::vector<void**> out_arrays;
+    for(auto& d : data)
+    {
+        in_arrays.push_back(&d.in_ptr);
+        out_arrays.push_back(&d.out_ptr);
+    }
+    ASSERT_EQ(rocfft_execute_many(
+                  plans.data(), plans.size(), in_arrays.data(), out_arrays.data(), info),
+              rocfft_status_success);
+
+    for(size_t i = 0; i < lengths.size(); ++i)
+        EXPECT_EQ(data[i].output(), expected[i]);
+
+    rocfft_execution_info_destroy(info);
+    for(auto plan : plans)
+        rocfft_plan_destroy(plan);
+    rocfft_cleanup();
+}
+
+// check a grouped plan against one plan per problem
+TEST(rocfft_UnitTest, grouped_plan)
+{
+    rocfft_setup();
+
+    // three evenly spaced problems of length 16 share one batch, the
+    // others each need their own
+    std::vector<size_t> lengths    = {16, 64, 16, 16, 100, 16};
+    std::vector<size_t> in_offsets = {0, 48, 16, 32, 112, 300};
+    std::vector<size_t> in_strides = {1, 1, 1, 1, 1, 2};
+    size_t              total      = 332;
+
+    rocfft_grouped_plan grouped = nullptr;
+    ASSERT_EQ(rocfft_grouped_plan_create(&grouped,
+                                         rocfft_placement_notinplace,
+                                         rocfft_transform_type_complex_forward,
+                                         rocfft_precision_single,
+                                         lengths.size(),
+                                         lengths.data(),
+                                         in_offsets.data(),
+                                         in_strides.data(),
+                                         in_offsets.data(),
+                                         in_strides.data()),
+              rocfft_status_success);
+
+    size_t work_size = 0;
+    ASSERT_EQ(rocfft_grouped_plan_get_work_buffer_size(grouped, &work_size),
+              rocfft_status_success);
+    EXPECT_EQ(work_size, 0);
+
+    complex_test_data data(total);
+    hipMemset(data.out_ptr, 0, data.bytes);
+
+    // expected results, one plan per problem
+    for(size_t i = 0; i < lengths.size(); ++i)
+    {
+        rocfft_plan_description desc = nullptr;
+        ASSERT_EQ(rocfft_plan_description_create(&desc), rocfft_status_success);
+        ASSERT_EQ(rocfft_plan_description_set_data_layout(desc,
+                                                          rocfft_array_type_complex_interleaved,
+                                                          rocfft_array_type_complex_interleaved,
+                                                          nullptr,
+                                                          nullptr,
+                                                          1,
+                                                          &in_strides[i],
+                                                          0,
+                                                          1,
+                                                          &in_strides[i],
+                                                          0),
+                  rocfft_status_success);
+        rocfft_plan plan = nullptr;
+        ASSERT_EQ(rocfft_plan_create(&plan,
+                                     rocfft_placement_notinplace,
+                                     rocfft_transform_type_complex_forward,
+                                     rocfft_precision_single,
+                                     1,
+                                     &lengths[i],
+                                     1,
+                                     desc),
+                  rocfft_status_success);
+        void* in_ptr  = static_cast<float*>(data.in_ptr) + 2 * in_offsets[i];
+        void* out_ptr = static_cast<float*>(data.out_ptr) + 2 * in_offsets[i];
+        ASSERT_EQ(rocfft_execute(plan, &in_ptr, &out_ptr, nullptr), rocfft_status_success);
+        rocfft_plan_destroy(plan);
+        rocfft_plan_description_destroy(desc);
+    }
+    auto expected = data.output();
+
+    hipMemset(data.out_ptr, 0, data.bytes);
+    ASSERT_EQ(rocfft_execute_grouped(grouped, &data.in_ptr, &data.out_ptr, nullptr),
+              rocfft_status_success);
+    EXPECT_EQ(data.output(), expected);
+
+    rocfft_grouped_plan_destroy(grouped);
+    rocfft_cleanup();
+}
+
+// evenly spaced problems that overlap must not be batched together,
+// since an in-place batch would read data that another problem of the
+// batch has already written
+TEST(rocfft_UnitTest, grouped_plan_overlap)
+{
+    rocfft_setup();
+
+    const size_t        length     = 16;
+    std::vector<size_t> lengths    = {length, length, length};
+    std::vector<size_t> in_offsets = {0, 8, 16};
+    size_t              total      = 32;
+
+    rocfft_grouped_plan grouped = nullptr;
+    ASSERT_EQ(rocfft_grouped_plan_create(&grouped,
+                                         rocfft_placement_inplace,
+                                         rocfft_transform_type_complex_forward,
+                                         rocfft_precision_single,
+                                         lengths.size(),
+                                         lengths.data(),
+                                         in_offsets.data(),
+                                         nullptr,
+                                         nullptr,
+                                         nullptr),
+              rocfft_status_success);
+
+    // expected results, one problem after another
+    complex_test_data data(total, rocfft_placement_inplace);
+    rocfft_plan       plan = nullptr;
+    ASSERT_EQ(rocfft_plan_create(&plan,
+                                 rocfft_placement_inplace,
+                                 rocfft_transform_type_complex_forward,
+                                 rocfft_precision_single,
+                                 1,
+                                 &length,
+                                 1,
+                                 nullptr),
+              rocfft_status_success);
+    for(auto offset : in_offsets)
+    {
+        void* ptr = static_cast<float*>(data.in_ptr) + 2 * offset;
+        ASSERT_EQ(rocfft_execute(plan, &ptr, nullptr, nullptr), rocfft_status_success);
+    }
+    auto expected = data.output();
+
+    hipMemcpy(data.in_ptr, data.host.data(), data.bytes, hipMemcpyHostToDevice);
+    ASSERT_EQ(rocfft_execute_grouped(grouped, &data.in_ptr, nullptr, nullptr),
+              rocfft_status_success);
+    auto actual = data.output();
+    for(size_t i = 0; i < actual.size(); ++i)
+        EXPECT_NEAR(actual[i], expected[i], 1e-4 * std::abs(expected[i]) + 1e-4);
+
+    rocfft_plan_destroy(plan);
+    rocfft_grouped_plan_destroy(grouped);
+    rocfft_cleanup();
+}
+
+TEST(rocfft_UnitTest, batch_pointers)
+{
+    rocfft_setup();
+
+    const size_t length = 64;
+    const size_t batch  = 4;
+
+    rocfft_plan_description desc = nullptr;
+    ASSERT_EQ(rocfft_plan_description_create(&desc), rocfft_status_success);
+    ASSERT_EQ(rocfft_plan_description_set_batch_pointers(desc, 1), rocfft_status_success);
+
+    // multi-dimensional transforms are rejected
+    rocfft_plan  plan2D      = nullptr;
+    const size_t lengths2D[] = {length, length};
+    EXPECT_EQ(rocfft_plan_create(&plan2D,
+                                 rocfft_placement_notinplace,
+                                 rocfft_transform_type_complex_forward,
+                                 rocfft_precision_single,
+                                 2,
+                                 lengths2D,
+                                 batch,
+                                 desc),
+              rocfft_status_invalid_dimensions);
+
+    rocfft_plan plan = nullptr;
+    ASSERT_EQ(rocfft_plan_create(&plan,
+                                 rocfft_placement_notinplace,
+                                 rocfft_transform_type_complex_forward,
+                                 rocfft_precision_single,
+                                 1,
+                                 &length,
+                                 batch,
+                                 desc),
+              rocfft_status_success);
+    rocfft_plan plan_contiguous = nullptr;
+    ASSERT_EQ(rocfft_plan_create(&plan_contiguous,
+                                 rocfft_placement_notinplace,
+                                 rocfft_transform_type_complex_forward,
+                                 rocfft_precision_single,
+                                 1,
+                                 &length,
+                                 batch,
+                                 nullptr),
+              rocfft_status_success);
+
+    // expected result from contiguous buffers
+    complex_test_data data(length * batch);
+    auto              expected         = data.run(plan_contiguous);
+    const size_t      batch_size_bytes = data.bytes / batch;
+
+    // same batch, with each transform in its own allocation
+    std::vector<gpubuf> in_batches(batch);
+    std::vector<gpubuf> out_batches(batch);
+    std::vector<void*>  in_ptrs;
+    std::vector<void*>  out_ptrs;
+    for(size_t b = 0; b < batch; ++b)
+    {
+        ASSERT_EQ(in_batches[b].alloc(batch_size_bytes), hipSuccess);
+        ASSERT_EQ(out_batches[b].alloc(batch_size_bytes), hipSuccess);
+        hipMemcpy(in_batches[b].data(),
+                  data.host.data() + b * length * 2,
+                  batch_size_bytes,
+                  hipMemcpyHostToDevice);
+        in_ptrs.push_back(in_batches[b].data());
+        out_ptrs.push_back(out_batches[b].data());
+    }
+    gpubuf in_ptrs_device;
+    gpubuf out_ptrs_device;
+    ASSERT_EQ(in_ptrs_device.alloc(batch * sizeof(void*)), hipSuccess);
+    ASSERT_EQ(out_ptrs_device.alloc(batch * sizeof(void*)), hipSuccess);
+    hipMemcpy(
+        in_ptrs_device.data(), in_ptrs.data(), batch * sizeof(void*), hipMemcpyHostToDevice);
+    hipMemcpy(
+        out_ptrs_device.data(), out_ptrs.data(), batch * sizeof(void*), hipMemcpyHostToDevice);
+
+    void* in_ptr  = in_ptrs_device.data();
+    void* out_ptr = out_ptrs_device.data();
+    ASSERT_EQ(rocfft_execute(plan, &in_ptr, &out_ptr, nullptr), rocfft_status_success);
+
+    std::vector<float> actual(data.host.size());
+    for(size_t b = 0; b < batch; ++b)
+        hipMemcpy(actual.data() + b * length * 2,
+                  out_batches[b].data(),
+                  batch_size_bytes,
+                  hipMemcpyDeviceToHost);
+    EXPECT_EQ(actual, expected);
+
+    rocfft_plan_destroy(plan);
+    rocfft_plan_destroy(plan_contiguous);
+    rocfft_plan_description_destroy(desc);
+    rocfft_cleanup();
+}
+
+TEST(rocfft_UnitTest, plan_set_batch)
+{
+    rocfft_setup();
+
+    const size_t length    = 64;
+    const size_t max_batch = 8;
+
+    rocfft_plan plan = nullptr;
+    ASSERT_EQ(rocfft_plan_create(&plan,
+                                 rocfft_placement_notinplace,
+                                 rocfft_transform_type_complex_forward,
+                                 rocfft_precision_single,
+                                 1,
+                                 &length,
+                                 1,
+                                 nullptr),
+              rocfft_status_success);
+    EXPECT_EQ(rocfft_plan_set_batch(plan, 0), rocfft_status_invalid_arg_value);
+
+    complex_test_data data(length * max_batch, rocfft_placement_notinplace, 11);
+
+    for(size_t batch = 1; batch <= max_batch; batch *= 2)
+    {
+        ASSERT_EQ(rocfft_plan_set_batch(plan, batch), rocfft_status_success);
+
+        // changing the batch keeps one plan in the repo
+        size_t plan_unique_count = 0;
+        rocfft_repo_get_unique_plan_count(&plan_unique_count);
+        EXPECT_EQ(plan_unique_count, 1);
+
+        auto actual = data.run(plan);
+
+        // compare with a plan created for this batch
+        rocfft_plan plan_batch = nullptr;
+        ASSERT_EQ(rocfft_plan_create(&plan_batch,
+                                     rocfft_placement_notinplace,
+                                     rocfft_transform_type_complex_forward,
+                                     rocfft_precision_single,
+                                     1,
+                                     &length,
+                                     batch,
+                                     nullptr),
+                  rocfft_status_success);
+        EXPECT_EQ(actual, data.run(plan_batch));
+        rocfft_plan_destroy(plan_batch);
+    }
+
+    rocfft_plan_destroy(plan);
+    rocfft_cleanup();
+}
+
+// Callbacks that double each input element and add 1 to the real
+// part of each output element
+__device__ float2 load_double_cb(float2* buffer, size_t offset, void*)
+{
+    float2 element = buffer[offset];
+    return make_float2(element.x * 2, element.y * 2);
+}
+
+__device__ void store_add_cb(float2* buffer, size_t offset, float2 element, void*)
+{
+    buffer[offset] = make_float2(element.x + 1, element.y);
+}
+
+__device__ auto load_double_cb_ptr = load_double_cb;
+__device__ auto store_add_cb_ptr   = store_add_cb;
+
+TEST(rocfft_UnitTest, plan_callbacks)
+{
+    rocfft_setup();
+
+    const size_t length = 64;
+    const size_t batch  = 4;
+
+    rocfft_plan plan = nullptr;
+    ASSERT_EQ(rocfft_plan_create(&plan,
+                                 rocfft_placement_notinplace,
+                                 rocfft_transform_type_complex_forward,
+                                 rocfft_precision_single,
+                                 1,
+                                 &length,
+                                 batch,
+                                 nullptr),
+              rocfft_status_success);
+
+    void* load_fn  = nullptr;
+    void* store_fn = nullptr;
+    ASSERT_EQ(hipMemcpyFromSymbol(&load_fn, HIP_SYMBOL(load_double_cb_ptr), sizeof(void*)),
+              hipSuccess);
+    ASSERT_EQ(hipMemcpyFromSymbol(&store_fn, HIP_SYMBOL(store_add_cb_ptr), sizeof(void*)),
+              hipSuccess);
+
+    complex_test_data data(length * batch, rocfft_placement_notinplace, 11);
+    auto              expected = data.run(plan);
+    for(size_t i = 0; i < expected.size(); ++i)
+        expected[i] = expected[i] * 2 + (i % 2 == 0 ? 1 : 0);
+
+    ASSERT_EQ(rocfft_plan_set_load_callback(plan, load_fn, nullptr), rocfft_status_success);
+    ASSERT_EQ(rocfft_plan_set_store_callback(plan, store_fn, nullptr), rocfft_status_success);
+    auto actual = data.run(plan);
+    for(size_t i = 0; i < actual.size(); ++i)
+        EXPECT_NEAR(actual[i], expected[i], 1e-4 * std::abs(expected[i]) + 1e-4);
+
+    // callbacks are not available for real transforms
+    rocfft_plan plan_real = nullptr;
+    ASSERT_EQ(rocfft_plan_create(&plan_real,
+                                 rocfft_placement_notinplace,
+                                 rocfft_transform_type_real_forward,
+                                 rocfft_precision_single,
+                                 1,
+                                 &length,
+                                 batch,
+                                 nullptr),
+              rocfft_status_success);
+    EXPECT_EQ(rocfft_plan_set_load_callback(plan_real, load_fn, nullptr),
+              rocfft_status_invalid_arg_value);
+    EXPECT_EQ(rocfft_plan_set_load_callback(nullptr, load_fn, nullptr),
+              rocfft_status_invalid_arg_value);
+
+    rocfft_plan_destroy(plan_real);
+    rocfft_plan_destroy(plan);
+    rocfft_cleanup();
+}
@@ -56,6 +56,12 @@ typedef struct rocfft_plan_description_t* rocfft_plan_description;
  *  */
 typedef struct rocfft_execution_info_t* rocfft_execution_info;
 
+/*! @brief Pointer type to grouped plan structure
+ *  @details This type is used to declare a grouped plan handle that can be
+ * initialized with rocfft_grouped_plan_create
+ *  */
+typedef struct rocfft_grouped_plan_t* rocfft_grouped_plan;
+
 /*! @brief rocfft status/error codes */
 typedef enum rocfft_status_e
 {
@@ -131,7 +137,8 @@ ROCFFT_EXPORT rocfft_status rocfft_cleanup();
  * This function
  *  takes many of the fundamental parameters needed to specify a transform. The
  * parameters are
- *  self explanatory. The dimensions parameter can take a value of 1,2 or 3. The
+ *  self explanatory. The dimensions parameter can take a value from 1 to 8 for
+ * complex transforms, and 1, 2 or 3 for real transforms. The
  * 'lengths' array specifies
  *  size of data in each dimension. Note that lengths[0] is the size of the
  * innermost dimension, lengths[1]
@@ -164,6 +171,73 @@ ROCFFT_EXPORT rocfft_status rocfft_plan_create(rocfft_plan*                  pla
                                                size_t                        number_of_transforms,
                                                const rocfft_plan_description description);
 
+/*! @brief Change the number of transforms of an FFT plan
+ *
+ *  @details This API changes the batch count of an existing plan,
+ *  keeping its other parameters.  Device twiddle tables and kernel
+ *  arguments of the plan are carried over to the new batch count
+ *  when no other plan shares them, so that only the kernel launch
+ *  dimensions are recomputed.  Work buffer requirements may change,
+ *  and should be queried again with rocfft_plan_get_work_buffer_size.
+ *
+ *  @param[in, out] plan plan handle
+ *  @param[in] number_of_transforms new number of transforms
+ */
+ROCFFT_EXPORT rocfft_status rocfft_plan_set_batch(rocfft_plan  plan,
+                                                  const size_t number_of_transforms);
+
+/*! @brief Set a load callback for an FFT plan
+ *
+ *  @details The load callback is a device function that the plan
+ *  calls to read each element of its input, instead of reading the
+ *  input buffer directly.  It has the signature
+ *
+ *  T load(T* buffer, size_t offset, void* cb_data)
+ *
+ *  where T is float2 or double2 depending on the precision of the
+ *  plan, buffer is the input buffer given to rocfft_execute and
+ *  offset is the element to read, in elements from the start of
+ *  buffer.  cb_data is passed unchanged.
+ *
+ *  Callbacks are done by the generated kernels of the plan, so they
+ *  are only available for complex interleaved transforms whose first
+ *  kernel reads the input with a single Stockham kernel, e.g. 1D
+ *  lengths done by a single kernel and the row transforms of 2D and
+ *  3D transforms.  rocfft_status_invalid_arg_value is returned for
+ *  other plans.
+ *
+ *  @param[in, out] plan plan handle
+ *  @param[in] cb_function device pointer to the load function, or
+ *  null to remove the callback
+ *  @param[in] cb_data device pointer passed to the load function
+ */
+ROCFFT_EXPORT rocfft_status rocfft_plan_set_load_callback(rocfft_plan plan,
+                                                          void*       cb_function,
+                                                          void*       cb_data);
+
+/*! @brief Set a store callback for an FFT plan
+ *
+ *  @details The store callback is a device function that the plan
+ *  calls to write each element of its output, instead of writing the
+ *  output buffer directly.  It has the signature
+ *
+ *  void store(T* buffer, size_t offset, T element, void* cb_data)
+ *
+ *  where buffer is the output buffer given to rocfft_execute (or the
+ *  input buffer for in-place transforms), and the other parameters
+ *  are as for rocfft_plan_set_load_callback.  Store callbacks are
+ *  only available for complex interleaved transforms whose output is
+ *  written by a single Stockham kernel.
+ *
+ *  @param[in, out] plan plan handle
+ *  @param[in] cb_function device pointer to the store function, or
+ *  null to remove the callback
+ *  @param[in] cb_data device pointer passed to the store function
+ */
+ROCFFT_EXPORT rocfft_status rocfft_plan_set_store_callback(rocfft_plan plan,
+                                                           void*       cb_function,
+                                                           void*       cb_data);
+
 /*! @brief Execute an FFT plan
  *
  *  @details This API executes an FFT plan on buffers given by the user. If the
@@ -199,6 +273,101 @@ ROCFFT_EXPORT rocfft_status rocfft_execute(const rocfft_plan     plan,
                                            void*                 out_buffer[],
                                            rocfft_execution_info info);
 
+/*! @brief Execute several FFT plans in sequence
+ *  @details This API executes a list of plans, one after another, as if
+ * rocfft_execute were called for each plan in turn with the same execution
+ * info.  The plans are looked up and the work buffer is checked once for the
+ * whole list, so a work buffer given in the execution info must be large
+ * enough for the plan with the largest requirement.
+ *
+ *  Events reported by rocfft_execution_info_get_events cover all of the
+ * plans.
+ *
+ *  @param[in] plans array of plan handles
+ *  @param[in] number_of_plans number of plans (size of plans array)
+ *  @param[in,out] in_buffers array of input buffer arrays, one per plan,
+ * each as would be passed to rocfft_execute
+ *  @param[in,out] out_buffers array of output buffer arrays, one per plan,
+ * each as would be passed to rocfft_execute.  Can be nullptr if all plans
+ * have inplace result placement
+ *  @param[in] info execution info handle created by
+ * rocfft_execution_info_create
+ *  */
+ROCFFT_EXPORT rocfft_status rocfft_execute_many(const rocfft_plan     plans[],
+                                                size_t                number_of_plans,
+                                                void**                in_buffers[],
+                                                void**                out_buffers[],
+                                                rocfft_execution_info info);
+
+/*! @brief Create a grouped FFT plan
+ *  @details This API creates a plan for a set of independent 1D complex
+ * transforms, each of which may have a different length, offset and stride.
+ * All problems read from the same input buffer and write to the same output
+ * buffer, at the given offsets.  Interleaved complex data is assumed.
+ *
+ *  Problems of the same length and strides whose offsets are evenly spaced
+ * are executed together as one batch, so storing problems of the same length
+ * at a constant distance from each other minimizes the number of kernel
+ * launches.  Problems whose data overlap are never executed in the same
+ * batch.
+ *
+ *  @param[out] plan grouped plan handle
+ *  @param[in] placement placement of result
+ *  @param[in] transform_type type of transform, which must be a complex
+ * transform
+ *  @param[in] precision precision
+ *  @param[in] num_problems number of transforms
+ *  @param[in] lengths array of num_problems transform lengths
+ *  @param[in] in_offsets array of num_problems offsets, in elements,
+ * of each problem's input
+ *  @param[in] in_strides array of num_problems input strides, or
+ * nullptr for unit strides
+ *  @param[in] out_offsets array of num_problems offsets, in elements,
+ * of each problem's output.  Ignored for inplace placement.
+ *  @param[in] out_strides array of num_problems output strides, or
+ * nullptr for unit strides.  Ignored for inplace placement.
+ *  */
+ROCFFT_EXPORT rocfft_status rocfft_grouped_plan_create(rocfft_grouped_plan*          plan,
+                                                       const rocfft_result_placement placement,
+                                                       const rocfft_transform_type   transform_type,
+                                                       const rocfft_precision        precision,
+                                                       const size_t                  num_problems,
+                                                       const size_t*                 lengths,
+                                                       const size_t*                 in_offsets,
+                                                       const size_t*                 in_strides,
+                                                       const size_t*                 out_offsets,
+                                                       const size_t*                 out_strides);
+
+/*! @brief Get work buffer size for a grouped plan
+ *  @details Get the work buffer size required for a grouped plan, as with
+ * rocfft_plan_get_work_buffer_size.
+ *  @param[in] plan grouped plan handle
+ *  @param[out] size_in_bytes size of needed work buffer in bytes
+ *  */
+ROCFFT_EXPORT rocfft_status rocfft_grouped_plan_get_work_buffer_size(
+    const rocfft_grouped_plan plan, size_t* size_in_bytes);
+
+/*! @brief Execute a grouped FFT plan
+ *  @details This API executes every transform in a grouped plan.  Buffers and
+ * execution info are as for rocfft_execute, except that only interleaved
+ * buffers are accepted.
+ *  @param[in] plan grouped plan handle
+ *  @param[in,out] in_buffer array of size 1 holding the input buffer
+ *  @param[in,out] out_buffer array of size 1 holding the output buffer, can
+ * be nullptr for inplace result placement
+ *  @param[in] info execution info handle created by
+ * rocfft_execution_info_create
+ *  */
+ROCFFT_EXPORT rocfft_status rocfft_execute_grouped(const rocfft_grouped_plan plan,
+                                                   void*                     in_buffer[],
+                                                   void*                     out_buffer[],
+                                                   rocfft_execution_info     info);
+
+/*! @brief Destroy a grouped FFT plan
+ *  @param[in] plan grouped plan handle
+ *  */
+ROCFFT_EXPORT rocfft_status rocfft_grouped_plan_destroy(rocfft_grouped_plan plan);
+
 /*! @brief Destroy an FFT plan
  *  @details This API frees the plan. This function destructs a plan after it is
  * no longer needed.
@@ -267,6 +436,27 @@ ROCFFT_EXPORT rocfft_status
                                             const size_t*           out_strides,
                                             const size_t            out_distance);
 
+/*! @brief Use device arrays of per-batch pointers as plan buffers
+ *
+ *  @details This is one of plan description functions to specify
+ *  optional additional plan properties using the description
+ *  handle.  When enabled, the first input and output buffers passed
+ *  to rocfft_execute are device arrays holding one pointer to the
+ *  start of each transform in the batch, instead of one contiguous
+ *  allocation.  Strides are applied relative to each pointer, and
+ *  distances are ignored.
+ *
+ *  This is only supported for 1D complex interleaved transforms
+ *  without offsets, whose length can be computed by a single kernel.
+ *  Plan creation fails for other transforms.
+ *
+ *  @param[in, out] description description handle
+ *  @param[in] enable nonzero to use per-batch pointers
+ */
+ROCFFT_EXPORT rocfft_status
+    rocfft_plan_description_set_batch_pointers(rocfft_plan_description description,
+                                               const int               enable);
+
 /*! @brief Get library version string
  *
  * @param[in, out] buf buffer of version string
@@ -346,17 +536,20 @@ ROCFFT_EXPORT rocfft_status rocfft_execution_info_set_work_buffer(rocfft_executi
                                                                   void*                 work_buffer,
                                                                   const size_t size_in_bytes);
 
-#if 0
 /*! @brief Set execution mode in execution info
- *  @details This is one of the execution info functions to specify optional additional information to control execution.
- *  This API specifies execution mode. It has to be called before the call to rocfft_execute.
- *  Appropriate enumeration value can be specified to control blocking/non-blocking behavior of the rocfft_execute call.
+ *  @details This is one of the execution info functions to specify optional
+ * additional information to control execution.
+ *  This API specifies execution mode. It has to be called before the call to
+ * rocfft_execute.
+ *  Appropriate enumeration value can be specified to control
+ * blocking/non-blocking behavior of the rocfft_execute call.  In blocking
+ * mode, rocfft_execute waits for the transform to finish on the stream
+ * before returning.  The default is rocfft_exec_mode_nonblocking.
  *  @param[in] info execution info handle
  *  @param[in] mode execution mode
  *  */
-ROCFFT_EXPORT rocfft_status rocfft_execution_info_set_mode( rocfft_execution_info info,
-                                                            const rocfft_execution_mode mode );
-#endif
+ROCFFT_EXPORT rocfft_status rocfft_execution_info_set_mode(rocfft_execution_info       info,
+                                                           const rocfft_execution_mode mode);
 
 /*! @brief Set stream in execution info
  *  @details This is one of the execution info functions to specify optional
@@ -374,17 +567,82 @@ ROCFFT_EXPORT rocfft_status rocfft_execution_info_set_mode( rocfft_execution_inf
 ROCFFT_EXPORT rocfft_status rocfft_execution_info_set_stream(rocfft_execution_info info,
                                                              void*                 stream);
 
-#if 0
+/*! @brief Use the library's work buffer pool in execution info
+ *  @details This is one of the execution info functions to specify optional
+ * additional information to control execution.
+ *  When enabled, rocfft_execute takes a work buffer from a pool managed by
+ * the library whenever the plan needs one and no sufficient work buffer was
+ * given with rocfft_execution_info_set_work_buffer.  Pooled buffers are
+ * associated with the execution stream and are reused by later executions
+ * of any plan on that stream.  Cached memory is released by
+ * rocfft_work_buffer_pool_trim and rocfft_cleanup.
+ *  @param[in] info execution info handle
+ *  @param[in] enable non-zero to use the work buffer pool
+ *  */
+ROCFFT_EXPORT rocfft_status rocfft_execution_info_set_work_buffer_pool(rocfft_execution_info info,
+                                                                       const int enable);
+
+/*! @brief Enable launch graphs in execution info
+ *  @details This is one of the execution info functions to specify optional
+ * additional information to control execution.
+ *  When enabled, the kernel launches of a plan are recorded into a HIP graph
+ * once a plan has been executed twice on the same stream with the same
+ * input, output and work buffers.  Later executions with those buffers
+ * replay the graph instead of launching each kernel.  Executions with other
+ * buffers, or on the null stream, launch kernels directly.  Each plan keeps
+ * a bounded number of recorded graphs.
+ *  @param[in] info execution info handle
+ *  @param[in] enable non-zero to enable launch graphs, zero to disable
+ *  */
+ROCFFT_EXPORT rocfft_status rocfft_execution_info_set_launch_graph(rocfft_execution_info info,
+                                                                   const int             enable);
+
+/*! @brief Record per-kernel events in execution info
+ *  @details This is one of the execution info functions to specify optional
+ * additional information to control execution.
+ *  By default, rocfft_execute records one event on the stream when the
+ * transform is complete.  When enabled, one event is recorded after each
+ * kernel launch instead, the last of which marks completion of the
+ * transform.
+ *  @param[in] info execution info handle
+ *  @param[in] enable non-zero to record an event per kernel
+ *  */
+ROCFFT_EXPORT rocfft_status rocfft_execution_info_set_kernel_events(rocfft_execution_info info,
+                                                                    const int             enable);
+
 /*! @brief Get events from execution info
- *  @details This is one of the execution info functions to retrieve information from execution.
- *  This API obtains event information. It has to be called after the call to rocfft_execute.
- *  This gets handles to events that the library created around one or more kernel launches during execution.
+ *  @details This is one of the execution info functions to retrieve
+ * information from execution.
+ *  This API obtains event information. It has to be called after the call to
+ * rocfft_execute.
+ *  This gets handles to events that the library recorded on the stream
+ * during the last rocfft_execute with this execution info.  Each event is
+ * a hipEvent_t, which may be waited on or queried to chain dependent work.
+ * The events are owned by the execution info and are reused by the next
+ * rocfft_execute with it.
  *  @param[in] info execution info handle
- *  @param[out] events array of events
+ *  @param[out] events array of events, or NULL to only query the number
+ * of events
  *  @param[out] number_of_events number of events (size of events array)
  *  */
-ROCFFT_EXPORT rocfft_status rocfft_execution_info_get_events( const rocfft_execution_info info, void **events, size_t *number_of_events );
-#endif
+ROCFFT_EXPORT rocfft_status rocfft_execution_info_get_events(const rocfft_execution_info info,
+                                                             void**                      events,
+                                                             size_t* number_of_events);
+
+/*! @brief Release cached work buffers
+ *  @details Frees the memory held by the library's work buffer pool that is
+ * not in use by a call to rocfft_execute.
+ *  */
+ROCFFT_EXPORT rocfft_status rocfft_work_buffer_pool_trim();
+
+/*! @brief Get work buffer pool usage
+ *  @details Reports the device memory currently allocated by the library's
+ * work buffer pool, and the most it has had allocated at once.
+ *  @param[out] pool_bytes bytes currently allocated by the pool
+ *  @param[out] high_water_bytes most bytes allocated by the pool at once
+ *  */
+ROCFFT_EXPORT rocfft_status rocfft_work_buffer_pool_get_usage(size_t* pool_bytes,
+                                                              size_t* high_water_bytes);
 
 /*! \brief Indicates if layer is active with bitmask*/
 typedef enum rocfft_layer_mode_
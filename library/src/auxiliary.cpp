@@ -20,10 +20,12 @@
 * THE SOFTWARE.
 *******************************************************************************/
 
+#include "kernel_profiler.h"
 #include "logging.h"
 #include "rocfft.h"
 #include "rocfft_hip.h"
 #include "rocfft_ostream.hpp"
+#include "work_buffer_pool.h"
 #include <fcntl.h>
 #include <memory>
 
@@ -101,6 +103,10 @@ rocfft_status rocfft_cleanup()
 {
     log_trace(__func__);
 
+    // log any kernels that are still outstanding before profile
+    // logging is turned off
+    KernelProfiler::GetProfiler().Flush();
+
     LogSingleton::GetInstance().SetLayerMode(rocfft_layer_mode_none);
     // Close log files
     if(log_trace_fd != -1)
@@ -119,5 +125,7 @@ rocfft_status rocfft_cleanup()
         log_profile_fd = -1;
     }
 
+    WorkBufferPool::GetPool().Trim();
+
     return rocfft_status_success;
 }
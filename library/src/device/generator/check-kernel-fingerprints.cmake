@@ -0,0 +1,52 @@
+# Compare the fingerprints of the generated kernels, as written by the
+# generator to rocfft_kernel_fingerprints.txt, against a baseline:
+#
+#   cmake -DBASELINE=<file> -DCURRENT=<file> [-DUPDATE=ON]
+#         -P check-kernel-fingerprints.cmake
+#
+# Kernels that are in the baseline but were not generated are
+# skipped, so builds with a generator_pattern or generator_manifest
+# only check the kernels they build.  UPDATE=ON copies the current
+# fingerprints over the baseline instead.
+
+if( NOT BASELINE OR NOT CURRENT )
+  message( FATAL_ERROR "BASELINE and CURRENT fingerprint files are required" )
+endif()
+
+if( UPDATE )
+  configure_file( ${CURRENT} ${BASELINE} COPYONLY )
+  message( STATUS "Updated ${BASELINE}" )
+  return()
+endif()
+
+file( STRINGS ${BASELINE} baseline_lines REGEX "^[^#]" )
+file( STRINGS ${CURRENT} current_lines REGEX "^[^#]" )
+
+# each kernel is identified by its file and scheme
+foreach( line ${baseline_lines} )
+  string( REGEX MATCH "^[^ ]+ [^ ]+" kernel "${line}" )
+  string( MAKE_C_IDENTIFIER "${kernel}" kernel_id )
+  set( baseline_${kernel_id} "${line}" )
+endforeach()
+
+set( num_changed 0 )
+foreach( line ${current_lines} )
+  string( REGEX MATCH "^[^ ]+ [^ ]+" kernel "${line}" )
+  string( MAKE_C_IDENTIFIER "${kernel}" kernel_id )
+  if( NOT DEFINED baseline_${kernel_id} )
+    message( "new:      ${line}" )
+    math( EXPR num_changed "${num_changed} + 1" )
+  elseif( NOT "${baseline_${kernel_id}}" STREQUAL "${line}" )
+    message( "baseline: ${baseline_${kernel_id}}" )
+    message( "current:  ${line}" )
+    math( EXPR num_changed "${num_changed} + 1" )
+  endif()
+endforeach()
+
+list( LENGTH current_lines num_kernels )
+if( num_changed GREATER 0 )
+  message( FATAL_ERROR "${num_changed} of ${num_kernels} generated kernels differ from "
+    "${BASELINE}.  If the change is intended, update the baseline with "
+    "the update-kernel-fingerprints target." )
+endif()
+message( STATUS "${num_kernels} generated kernels match ${BASELINE}" )
@@ -6,14 +6,10 @@
 set( kernels_pow2
 rocfft_kernel_1024.h
 rocfft_kernel_128.h
-rocfft_kernel_128_sbcc.h
-rocfft_kernel_128_sbrc.h
 rocfft_kernel_16.h
 rocfft_kernel_1.h
 rocfft_kernel_2048.h
 rocfft_kernel_256.h
-rocfft_kernel_256_sbcc.h
-rocfft_kernel_256_sbrc.h
 rocfft_kernel_2.h
 rocfft_kernel_2D_128_16.h
 rocfft_kernel_2D_128_32.h
@@ -56,8 +52,6 @@ rocfft_kernel_4096.h
 rocfft_kernel_4.h
 rocfft_kernel_512.h
 rocfft_kernel_64.h
-rocfft_kernel_64_sbcc.h
-rocfft_kernel_64_sbrc.h
 rocfft_kernel_8.h
 )
 
@@ -97,8 +91,6 @@ rocfft_kernel_2D_25_25.h
 set( kernels_all
 rocfft_kernel_1000.h
 rocfft_kernel_100.h
-rocfft_kernel_100_sbcc.h
-rocfft_kernel_100_sbrc.h
 rocfft_kernel_1024.h
 rocfft_kernel_1080.h
 rocfft_kernel_108.h
@@ -112,8 +104,6 @@ rocfft_kernel_1250.h
 rocfft_kernel_125.h
 rocfft_kernel_1280.h
 rocfft_kernel_128.h
-rocfft_kernel_128_sbcc.h
-rocfft_kernel_128_sbrc.h
 rocfft_kernel_1296.h
 rocfft_kernel_12.h
 rocfft_kernel_1350.h
@@ -159,8 +149,6 @@ rocfft_kernel_2500.h
 rocfft_kernel_250.h
 rocfft_kernel_2560.h
 rocfft_kernel_256.h
-rocfft_kernel_256_sbcc.h
-rocfft_kernel_256_sbrc.h
 rocfft_kernel_2592.h
 rocfft_kernel_25.h
 rocfft_kernel_2700.h
@@ -220,9 +208,11 @@ rocfft_kernel_2D_9_27.h
 rocfft_kernel_2D_9_81.h
 rocfft_kernel_2D_9_9.h
 rocfft_kernel_2D_128_9.h
+rocfft_kernel_2D_16_243.h
 rocfft_kernel_2D_16_27.h
 rocfft_kernel_2D_16_81.h
 rocfft_kernel_2D_16_9.h
+rocfft_kernel_2D_243_16.h
 rocfft_kernel_2D_243_4.h
 rocfft_kernel_2D_243_8.h
 rocfft_kernel_2D_256_9.h
@@ -238,6 +228,7 @@ rocfft_kernel_2D_4_243.h
 rocfft_kernel_2D_4_27.h
 rocfft_kernel_2D_4_81.h
 rocfft_kernel_2D_4_9.h
+rocfft_kernel_2D_512_9.h
 rocfft_kernel_2D_64_27.h
 rocfft_kernel_2D_64_9.h
 rocfft_kernel_2D_81_16.h
@@ -253,6 +244,7 @@ rocfft_kernel_2D_9_16.h
 rocfft_kernel_2D_9_256.h
 rocfft_kernel_2D_9_32.h
 rocfft_kernel_2D_9_4.h
+rocfft_kernel_2D_9_512.h
 rocfft_kernel_2D_9_64.h
 rocfft_kernel_2D_9_8.h
 rocfft_kernel_2D_81_25.h
@@ -263,17 +255,21 @@ rocfft_kernel_2D_125_9.h
 rocfft_kernel_2D_25_81.h
 rocfft_kernel_2D_25_27.h
 rocfft_kernel_2D_25_9.h
+rocfft_kernel_2D_128_25.h
 rocfft_kernel_2D_64_25.h
 rocfft_kernel_2D_32_25.h
+rocfft_kernel_2D_32_125.h
 rocfft_kernel_2D_16_125.h
 rocfft_kernel_2D_16_25.h
 rocfft_kernel_2D_8_125.h
 rocfft_kernel_2D_8_25.h
 rocfft_kernel_2D_4_125.h
 rocfft_kernel_2D_4_25.h
+rocfft_kernel_2D_125_32.h
 rocfft_kernel_2D_125_16.h
 rocfft_kernel_2D_125_8.h
 rocfft_kernel_2D_125_4.h
+rocfft_kernel_2D_25_128.h
 rocfft_kernel_2D_25_64.h
 rocfft_kernel_2D_25_32.h
 rocfft_kernel_2D_25_16.h
@@ -327,8 +323,6 @@ rocfft_kernel_625.h
 rocfft_kernel_640.h
 rocfft_kernel_648.h
 rocfft_kernel_64.h
-rocfft_kernel_64_sbcc.h
-rocfft_kernel_64_sbrc.h
 rocfft_kernel_675.h
 rocfft_kernel_6.h
 rocfft_kernel_720.h
@@ -341,8 +335,6 @@ rocfft_kernel_800.h
 rocfft_kernel_80.h
 rocfft_kernel_810.h
 rocfft_kernel_81.h
-rocfft_kernel_81_sbcc.h
-rocfft_kernel_81_sbrc.h
 rocfft_kernel_864.h
 rocfft_kernel_8.h
 rocfft_kernel_900.h
@@ -351,12 +343,74 @@ rocfft_kernel_960.h
 rocfft_kernel_96.h
 rocfft_kernel_972.h
 rocfft_kernel_9.h
-rocfft_kernel_7.h
-rocfft_kernel_49.h
-rocfft_kernel_84.h
-rocfft_kernel_112.h
 )
 
+# Lengths with a radix-7 factor, as listed by append_prime_size_list in
+# generator.main.cpp
+foreach( len
+    7 14 21 28 35 42 49 56 63 70 84 98 105 112 126 140 147 168 175 189 196 210
+    224 245 252 280 294 315 336 343 350 378 392 420 441 448 490 504 525 560 567
+    588 630 672 686 700 735 756 784 840 875 882 896 945 980 1008 1029 1050 1120
+    1134 1176 1225 1260 1323 1344 1372 1400 1470 1512 1568 1575 1680 1701 1715
+    1750 1764 1792 1890 1960 2016 2058 2100 2205 2240 2268 2352 2401 2450 2520
+    2625 2646 2688 2744 2800 2835 2940 3024 3087 3136 3150 3360 3402 3430 3500
+    3528 3584 3675 3780 3920 3969 4032 )
+  list( APPEND kernels_all rocfft_kernel_${len}.h )
+endforeach()
+
+# Block column kernels, as listed by generate_large1D_list in
+# generator.main.cpp
+function( rocfft_block_kernels output_var )
+  set( kernels ${${output_var}} )
+  foreach( len ${ARGN} )
+    list( APPEND kernels rocfft_kernel_${len}_sbcc.h rocfft_kernel_${len}_sbrc.h )
+  endforeach()
+  set( ${output_var} ${kernels} PARENT_SCOPE )
+endfunction()
+
+rocfft_block_kernels( kernels_pow2 16 32 64 128 256 512 )
+rocfft_block_kernels( kernels_pow3 27 81 )
+rocfft_block_kernels( kernels_pow5 125 )
+rocfft_block_kernels( kernels_all
+  16 27 32 48 54 64 72 75 80 81 96 98 100 108 112 125 128 135 144 160 162 189
+  192 196 200 216 224 225 240 250 256 288 320 324 375 384 392 400 405 432 448
+  480 500 512 )
+
+# Real 2D single kernels, as listed by Single2DRealSizes in
+# radix_table.h, named for their real length0 and length1.  They are
+# grouped by their half-length complex 2D size, like the kernel_launch
+# files that include them.
+function( rocfft_2D_real_kernels output_var )
+  set( kernels ${${output_var}} )
+  foreach( size ${ARGN} )
+    list( APPEND kernels rocfft_kernel_2D_real_${size}.h )
+  endforeach()
+  set( ${output_var} ${kernels} PARENT_SCOPE )
+endfunction()
+
+set( kernels_2D_real_pow2
+  8_4 8_8 8_16 8_32 8_64 8_128 8_256 16_4 16_8 16_16 16_32 16_64 16_128 16_256
+  32_4 32_8 32_16 32_32 32_64 32_128 64_4 64_8 64_16 64_32 64_64 64_128 128_4
+  128_8 128_16 128_32 256_4 256_8 256_16 256_32 512_4 512_8 )
+set( kernels_2D_real_pow3
+  18_9 18_27 18_81 18_243 54_9 54_27 54_81 162_9 162_27 486_9 )
+set( kernels_2D_real_pow5
+  50_25 50_125 250_25 )
+set( kernels_2D_real_mix
+  8_9 8_25 8_27 8_81 8_125 8_243 16_9 16_25 16_27 16_81 16_125 16_243 18_4
+  18_8 18_16 18_25 18_32 18_64 18_125 18_128 18_256 18_512 32_9 32_25 32_27
+  32_81 32_125 32_243 50_4 50_8 50_9 50_16 50_27 50_32 50_64 50_81 50_128 54_4
+  54_8 54_16 54_25 54_32 54_64 64_9 64_25 64_27 64_81 64_125 128_9 128_25
+  128_27 162_4 162_8 162_16 162_25 162_32 250_4 250_8 250_9 250_16 250_32
+  256_9 256_25 486_4 486_8 486_16 512_9 1024_9 )
+
+rocfft_2D_real_kernels( kernels_pow2 ${kernels_2D_real_pow2} )
+rocfft_2D_real_kernels( kernels_pow3 ${kernels_2D_real_pow3} )
+rocfft_2D_real_kernels( kernels_pow5 ${kernels_2D_real_pow5} )
+rocfft_2D_real_kernels( kernels_all
+  ${kernels_2D_real_pow2} ${kernels_2D_real_pow3} ${kernels_2D_real_pow5}
+  ${kernels_2D_real_mix} )
+
 set( kernels_launch
 kernel_launch_generator.h
 function_pool.cpp.h
@@ -365,23 +419,41 @@ kernel_launch_single_large.cpp.h
 kernel_launch_single_large.cpp
 kernel_launch_double_large.cpp.h
 kernel_launch_double_large.cpp
+kernel_launch_single_2D_pow2.cpp.h
 kernel_launch_single_2D_pow2.cpp
+kernel_launch_double_2D_pow2.cpp.h
 kernel_launch_double_2D_pow2.cpp
+kernel_launch_single_2D_pow3.cpp.h
 kernel_launch_single_2D_pow3.cpp
+kernel_launch_double_2D_pow3.cpp.h
 kernel_launch_double_2D_pow3.cpp
+kernel_launch_single_2D_pow5.cpp.h
 kernel_launch_single_2D_pow5.cpp
+kernel_launch_double_2D_pow5.cpp.h
 kernel_launch_double_2D_pow5.cpp
+kernel_launch_single_2D_mix_pow2_3.cpp.h
 kernel_launch_single_2D_mix_pow2_3.cpp
+kernel_launch_double_2D_mix_pow2_3.cpp.h
 kernel_launch_double_2D_mix_pow2_3.cpp
+kernel_launch_single_2D_mix_pow3_2.cpp.h
 kernel_launch_single_2D_mix_pow3_2.cpp
+kernel_launch_double_2D_mix_pow3_2.cpp.h
 kernel_launch_double_2D_mix_pow3_2.cpp
+kernel_launch_single_2D_mix_pow3_5.cpp.h
 kernel_launch_single_2D_mix_pow3_5.cpp
+kernel_launch_double_2D_mix_pow3_5.cpp.h
 kernel_launch_double_2D_mix_pow3_5.cpp
+kernel_launch_single_2D_mix_pow5_3.cpp.h
 kernel_launch_single_2D_mix_pow5_3.cpp
+kernel_launch_double_2D_mix_pow5_3.cpp.h
 kernel_launch_double_2D_mix_pow5_3.cpp
+kernel_launch_single_2D_mix_pow2_5.cpp.h
 kernel_launch_single_2D_mix_pow2_5.cpp
+kernel_launch_double_2D_mix_pow2_5.cpp.h
 kernel_launch_double_2D_mix_pow2_5.cpp
+kernel_launch_single_2D_mix_pow5_2.cpp.h
 kernel_launch_single_2D_mix_pow5_2.cpp
+kernel_launch_double_2D_mix_pow5_2.cpp.h
 kernel_launch_double_2D_mix_pow5_2.cpp
 )
 
@@ -397,3 +469,29 @@ foreach(small_kernel_group_id RANGE 0 ${max_group_num} )
     list(APPEND kernels_launch ${small_kernel_double_file} ${small_kernel_double_h_file})
 endforeach(small_kernel_group_id)
 
+
+# Kernel headers generated for a manifest of kernel sizes, as read by
+# apply_size_manifest in generator.main.cpp.  Power-of-2 1D kernels
+# are always generated, since other lengths fall back on them.
+function( rocfft_manifest_kernels manifest_file output_var )
+  set( kernels )
+  foreach( len 1 2 4 8 16 32 64 128 256 512 1024 2048 4096 )
+    list( APPEND kernels rocfft_kernel_${len}.h )
+  endforeach()
+
+  file( STRINGS ${manifest_file} manifest_lines )
+  foreach( line ${manifest_lines} )
+    if( line MATCHES "^[ \t]*1d[ \t]+([0-9]+)" )
+      list( APPEND kernels rocfft_kernel_${CMAKE_MATCH_1}.h )
+    elseif( line MATCHES "^[ \t]*(sbcc|sbrc)[ \t]+([0-9]+)" )
+      list( APPEND kernels rocfft_kernel_${CMAKE_MATCH_2}_${CMAKE_MATCH_1}.h )
+    elseif( line MATCHES "^[ \t]*2d[ \t]+([0-9]+)[ \t]+([0-9]+)" )
+      list( APPEND kernels rocfft_kernel_2D_${CMAKE_MATCH_1}_${CMAKE_MATCH_2}.h )
+    elseif( line MATCHES "^[ \t]*2d_real[ \t]+([0-9]+)[ \t]+([0-9]+)" )
+      list( APPEND kernels rocfft_kernel_2D_real_${CMAKE_MATCH_1}_${CMAKE_MATCH_2}.h )
+    endif()
+  endforeach()
+
+  list( REMOVE_DUPLICATES kernels )
+  set( ${output_var} ${kernels} PARENT_SCOPE )
+endfunction()
@@ -7,7 +7,11 @@
 #include "rocfft.h"
 #include <algorithm>
 #include <fstream>
+#include <iomanip>
 #include <iostream>
+#include <map>
+#include <mutex>
+#include <sstream>
 #include <string.h>
 #include <string>
 #include <vector>
@@ -121,22 +125,141 @@ rocfft_status initParams(FFTKernelGenKeyParams& params,
 }
 
 /* =====================================================================
-   Write butterfly device function to *.h file
+   Odd lengths also get fused real-to-complex/complex-to-real kernels.
+   Those stage all of a threadblock's transforms in LDS next to the
+   butterfly scratch space, so only generate them where that fits for
+   double precision.
 =================================================================== */
-void WriteButterflyToFile(std::string& str, int LEN)
+static bool RealSingleSupported(size_t len)
+{
+    if(len % 2 == 0)
+        return false;
+
+    FFTKernelGenKeyParams params;
+    initParams(params, {len}, false, BCT_C2C);
+
+    // complex staging buffer + real butterfly scratch
+    const size_t ldsBytes = len * params.fft_numTrans * 3 * sizeof(double);
+    return ldsBytes <= 64 * 1024;
+}
+
+/* =====================================================================
+   Write generated files, only touching those whose content changed
+   so that a rerun of the generator only rebuilds affected kernels
+=================================================================== */
+
+// 64-bit FNV-1a hash of a generated file, recorded in the manifest
+static uint64_t content_hash(const std::string& content)
 {
+    uint64_t hash = 14695981039346656037ULL;
+    for(unsigned char c : content)
+    {
+        hash ^= c;
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
 
-    std::ofstream file;
-    std::string   fileName = "rocfft_butterfly_" + std::to_string(LEN) + ".h";
-    file.open(fileName);
+// generated files included by a generated file
+static std::vector<std::string> generated_includes(const std::string& content)
+{
+    static const std::string include = "#include \"";
 
+    std::vector<std::string> includes;
+    std::istringstream       lines(content);
+    std::string              line;
+    while(std::getline(lines, line))
+    {
+        if(line.compare(0, include.size(), include) != 0)
+            continue;
+        auto end = line.find('"', include.size());
+        if(end == std::string::npos)
+            continue;
+        auto name = line.substr(include.size(), end - include.size());
+        if(name.compare(0, 14, "rocfft_kernel_") == 0 || name.compare(0, 14, "kernel_launch_") == 0
+           || name.compare(0, 13, "function_pool") == 0)
+            includes.push_back(name);
+    }
+    return includes;
+}
+
+struct GeneratedFile
+{
+    uint64_t                 hash;
+    bool                     changed;
+    std::vector<std::string> includes;
+};
+
+// kernels are written from several threads, so the list of
+// generated files is guarded by a mutex
+static std::mutex                           generated_files_mutex;
+static std::map<std::string, GeneratedFile> generated_files;
+
+void WriteFileIfChanged(const std::string& fileName, const std::string& content)
+{
+    bool changed = true;
+    {
+        std::ifstream existing(fileName, std::ios::binary);
+        if(existing.is_open())
+        {
+            std::ostringstream old;
+            old << existing.rdbuf();
+            changed = old.str() != content;
+        }
+    }
+
+    if(changed)
+    {
+        std::ofstream file(fileName, std::ios::binary);
+        if(!file.is_open())
+        {
+            // can't continue, fail the build
+            std::cout << "File: " << fileName << " could not be opened, exiting ...." << std::endl;
+            abort();
+        }
+        file << content;
+    }
+
+    std::lock_guard<std::mutex> lock(generated_files_mutex);
+    generated_files[fileName] = {content_hash(content), changed, generated_includes(content)};
+}
+
+void WriteGeneratedManifest(const std::string& fileName)
+{
+    // the manifest is always rewritten, since the build uses it to
+    // know when the generator last ran
+    std::ofstream file(fileName);
     if(!file.is_open())
     {
         std::cout << "File: " << fileName << " could not be opened, exiting ...." << std::endl;
+        abort();
     }
 
-    file << str;
-    file.close();
+    std::lock_guard<std::mutex> lock(generated_files_mutex);
+
+    size_t changed = 0;
+    file << "# <content hash> <generated file> [<generated files it includes> ...]\n";
+    for(const auto& f : generated_files)
+    {
+        file << std::hex << std::setw(16) << std::setfill('0') << f.second.hash << std::dec << " "
+             << f.first;
+        for(const auto& include : f.second.includes)
+            file << " " << include;
+        file << "\n";
+        if(f.second.changed)
+            ++changed;
+    }
+
+    std::cout << "Generated " << generated_files.size() << " files, " << changed << " changed"
+              << std::endl;
+}
+
+/* =====================================================================
+   Write butterfly device function to *.h file
+=================================================================== */
+void WriteButterflyToFile(std::string& str, int LEN)
+{
+    WriteFileIfChanged("rocfft_butterfly_" + std::to_string(LEN) + ".h", str);
 }
 
 /* =====================================================================
@@ -165,6 +288,13 @@ void WriteCPUHeaders(const std::vector<size_t>&
         std::string str_len = std::to_string(support_list[i]);
         str += "void rocfft_internal_dfn_sp_ci_ci_stoc_";
         str += str_len + "(const void *data_p, void *back_p);\n";
+        str += "void rocfft_internal_dfn_sp_ci_ci_stoc_cb_";
+        str += str_len + "(const void *data_p, void *back_p);\n";
+        if(RealSingleSupported(support_list[i]))
+        {
+            str += "void rocfft_internal_dfn_sp_real_stoc_";
+            str += str_len + "(const void *data_p, void *back_p);\n";
+        }
     }
 
     str += "\n";
@@ -174,6 +304,13 @@ void WriteCPUHeaders(const std::vector<size_t>&
         std::string str_len = std::to_string(support_list[i]);
         str += "void rocfft_internal_dfn_dp_ci_ci_stoc_";
         str += str_len + "(const void *data_p, void *back_p);\n";
+        str += "void rocfft_internal_dfn_dp_ci_ci_stoc_cb_";
+        str += str_len + "(const void *data_p, void *back_p);\n";
+        if(RealSingleSupported(support_list[i]))
+        {
+            str += "void rocfft_internal_dfn_dp_real_stoc_";
+            str += str_len + "(const void *data_p, void *back_p);\n";
+        }
     }
 
     str += "\n";
@@ -225,6 +362,11 @@ void WriteCPUHeaders(const std::vector<size_t>&
             str += "void rocfft_internal_dfn_sp_ci_ci_2D_" + suffix;
             str += "void rocfft_internal_dfn_dp_ci_ci_2D_" + suffix;
         }
+        else if(scheme == CS_KERNEL_2D_SINGLE_REAL)
+        {
+            str += "void rocfft_internal_dfn_sp_real_2D_" + suffix;
+            str += "void rocfft_internal_dfn_dp_real_2D_" + suffix;
+        }
     }
 
     str += "\n";
@@ -233,16 +375,7 @@ void WriteCPUHeaders(const std::vector<size_t>&
     str += "\n";
     str += "#endif";
 
-    std::ofstream file;
-    std::string   fileName = "kernel_launch_generator.h";
-    file.open(fileName);
-
-    if(!file.is_open())
-    {
-        std::cout << "File: " << fileName << " could not be opened, exiting ...." << std::endl;
-    }
-    file << str;
-    file.close();
+    WriteFileIfChanged("kernel_launch_generator.h", str);
 }
 
 /* =====================================================================
@@ -302,31 +435,23 @@ void write_cpu_function_small(std::vector<size_t> support_list,
                    + "_ci_ci_stoc_" + str_len + ", fft_fwd_ip_len" + str_len + ", fft_back_ip_len"
                    + str_len + ", fft_fwd_op_len" + str_len + ", fft_back_op_len" + str_len + ", "
                    + complex_case_precision + ")\n";
+            str += "POWX_SMALL_CALLBACK_GENERATOR( rocfft_internal_dfn_" + short_name_precision
+                   + "_ci_ci_stoc_cb_" + str_len + ", fft_fwd_ip_len" + str_len
+                   + "_cb, fft_back_ip_len" + str_len + "_cb, fft_fwd_op_len" + str_len
+                   + "_cb, fft_back_op_len" + str_len + "_cb, " + complex_case_precision + ")\n";
+            if(RealSingleSupported(support_list[i]))
+                str += "POWX_REAL_SMALL_GENERATOR( rocfft_internal_dfn_" + short_name_precision
+                       + "_real_stoc_" + str_len + ", fft_fwd_len" + str_len + "_r2c, fft_back_len"
+                       + str_len + "_c2r, " + complex_case_precision + ")\n";
         }
 
-        std::ofstream file;
-        std::string   headerFileName
+        std::string headerFileName
             = "kernel_launch_" + precision + "_" + std::to_string(j) + ".cpp.h";
-        file.open(headerFileName);
-
-        if(!file.is_open())
-        {
-            std::cout << "File: " << headerFileName << " could not be opened, exiting ...."
-                      << std::endl;
-        }
-        file << str;
-        file.close();
+        WriteFileIfChanged(headerFileName, str);
 
         std::string sourceFileName
             = "kernel_launch_" + precision + "_" + std::to_string(j) + ".cpp";
-        file.open(sourceFileName);
-        if(!file.is_open())
-        {
-            std::cout << "File: " << sourceFileName << " could not be opened, exiting ...."
-                      << std::endl;
-        }
-        file << "#include \"" << headerFileName << "\"";
-        file.close();
+        WriteFileIfChanged(sourceFileName, "#include \"" + headerFileName + "\"");
     }
 }
 
@@ -387,35 +512,23 @@ void write_cpu_function_large(std::vector<std::tuple<size_t, ComputeScheme>> lar
         }
     }
 
-    std::ofstream file;
-    std::string   headerFileName = "kernel_launch_" + precision + "_large.cpp.h";
-    file.open(headerFileName);
-
-    if(!file.is_open())
-    {
-        std::cout << "File: " << headerFileName << " could not be opened, exiting ...."
-                  << std::endl;
-    }
-    file << str;
-    file.close();
+    std::string headerFileName = "kernel_launch_" + precision + "_large.cpp.h";
+    WriteFileIfChanged(headerFileName, str);
 
     std::string sourceFileName = "kernel_launch_" + precision + "_large.cpp";
-    file.open(sourceFileName);
-    if(!file.is_open())
-    {
-        std::cout << "File: " << sourceFileName << " could not be opened, exiting ...."
-                  << std::endl;
-    }
-    file << "#include \"" << headerFileName << "\"";
-    file.close();
+    WriteFileIfChanged(sourceFileName, "#include \"" + headerFileName + "\"");
 }
 
 /* =====================================================================
    Write CPU functions for launching fused 2D kernels to *.cpp.h
 =================================================================== */
 // split fused kernels into separate files
-std::string get_2D_type(const std::tuple<size_t, size_t, ComputeScheme>& dim)
+std::string get_2D_type(std::tuple<size_t, size_t, ComputeScheme> dim)
 {
+    // real kernels are built from the half-length complex transform
+    if(std::get<2>(dim) == CS_KERNEL_2D_SINGLE_REAL)
+        std::get<0>(dim) /= 2;
+
     // power of 2
     if(IsPo2(std::get<0>(dim)) && IsPo2(std::get<1>(dim)))
     {
@@ -465,38 +578,24 @@ std::string get_2D_type(const std::tuple<size_t, size_t, ComputeScheme>& dim)
     abort();
 }
 
-std::ofstream& open_2D_file(const std::tuple<size_t, size_t, ComputeScheme>& dim,
-                            const std::string&                               precision,
-                            std::map<std::string, std::ofstream>&            files)
+// headers are built up in memory, keyed by file name, and written
+// once all kernels have been added
+std::ostringstream& open_2D_file(const std::string&                         type,
+                                 const std::string&                         precision,
+                                 std::map<std::string, std::ostringstream>& files)
 {
-    std::string type = get_2D_type(dim);
-
-    std::string    headerFileName = "kernel_launch_" + precision + "_2D_" + type + ".cpp.h";
-    auto           result         = files.emplace(type, headerFileName);
-    std::ofstream& file           = result.first->second;
+    std::string         headerFileName = "kernel_launch_" + precision + "_2D_" + type + ".cpp.h";
+    auto                result         = files.emplace(headerFileName, std::ostringstream());
+    std::ostringstream& file           = result.first->second;
 
     // if it was newly opened, initialize the file
     if(result.second)
     {
-        if(!file.is_open())
-        {
-            // can't continue, fail the build
-            std::cout << "Failed to open " << headerFileName << " for writing, aborting\n";
-            abort();
-        }
         file << "#include \"kernel_launch.h\"\n";
 
         // write source file to include this header
-        std::string   sourceFileName = "kernel_launch_" + precision + "_2D_" + type + ".cpp";
-        std::ofstream sourceFile(sourceFileName);
-        if(!file.is_open())
-        {
-            // fail build
-            std::cout << "File: " << sourceFileName << " could not be opened, exiting ...."
-                      << std::endl;
-            abort();
-        }
-        sourceFile << "#include \"" << headerFileName << "\"";
+        std::string sourceFileName = "kernel_launch_" + precision + "_2D_" + type + ".cpp";
+        WriteFileIfChanged(sourceFileName, "#include \"" + headerFileName + "\"");
     }
     return file;
 }
@@ -513,19 +612,33 @@ void write_cpu_function_2D(const std::vector<std::tuple<size_t, size_t, ComputeS
         short_name_precision   = "dp";
     }
 
-    std::map<std::string, std::ofstream> files;
+    std::map<std::string, std::ostringstream> files;
+
+    // every type gets a file, even with no kernels of that type, so
+    // the list of sources to build doesn't depend on the sizes
+    for(const auto& type : {"pow2",
+                            "pow3",
+                            "pow5",
+                            "mix_pow2_3",
+                            "mix_pow3_2",
+                            "mix_pow3_5",
+                            "mix_pow5_3",
+                            "mix_pow2_5",
+                            "mix_pow5_2"})
+        open_2D_file(type, precision, files);
+
     for(const auto& kernel : list_2D)
     {
-        std::ofstream& file          = open_2D_file(kernel, precision, files);
-        std::string    str_len_1     = std::to_string(std::get<0>(kernel));
-        std::string    str_len_2     = std::to_string(std::get<1>(kernel));
-        std::string    length_suffix = "_2D_" + str_len_1 + "_" + str_len_2;
-
-        file << "#include \"rocfft_kernel" << length_suffix << ".h\"\n";
+        std::ostringstream& file          = open_2D_file(get_2D_type(kernel), precision, files);
+        std::string         str_len_1     = std::to_string(std::get<0>(kernel));
+        std::string         str_len_2     = std::to_string(std::get<1>(kernel));
+        std::string         length_suffix = "_2D_" + str_len_1 + "_" + str_len_2;
 
         ComputeScheme scheme = std::get<2>(kernel);
         if(scheme == CS_KERNEL_2D_SINGLE)
         {
+            file << "#include \"rocfft_kernel" << length_suffix << ".h\"\n";
+
             // reuse the POWX_SMALL_GENERATOR because we're ultimately
             // calling those kernels in the same way
             file << "POWX_SMALL_GENERATOR(rocfft_internal_dfn_" << short_name_precision << "_ci_ci"
@@ -533,12 +646,364 @@ void write_cpu_function_2D(const std::vector<std::tuple<size_t, size_t, ComputeS
                  << length_suffix << ", fft_fwd_op" << length_suffix << ", fft_back_op"
                  << length_suffix << ", " << complex_case_precision << ")\n";
         }
+        else if(scheme == CS_KERNEL_2D_SINGLE_REAL)
+        {
+            file << "#include \"rocfft_kernel_2D_real_" << str_len_1 << "_" << str_len_2
+                 << ".h\"\n";
+
+            // real 2D kernels take the same arguments as the fused
+            // 1D real kernels
+            file << "POWX_REAL_SMALL_GENERATOR(rocfft_internal_dfn_" << short_name_precision
+                 << "_real" << length_suffix << ", fft_fwd" << length_suffix << "_r2c, fft_back"
+                 << length_suffix << "_c2r, " << complex_case_precision << ")\n";
+        }
         else
         {
             // not implemented yet
             abort();
         }
     }
+
+    for(const auto& file : files)
+        WriteFileIfChanged(file.first, file.second.str());
+}
+
+/* =====================================================================
+   Kernel metadata: launch parameters of each generated kernel, taken
+   from the same objects that generate its code.  They are compiled
+   into the function pool and written to rocfft_kernel_metadata.json.
+=================================================================== */
+
+struct KernelMetadataEntry
+{
+    std::vector<size_t> lengths;
+    ComputeScheme       scheme;
+    rocfft_precision    precision;
+    KernelMetadata      metadata;
+};
+
+static KernelMetadata
+    GetKernelMetadata(size_t len, ComputeScheme scheme, rocfft_precision precision)
+{
+    const size_t realBytes = precision == rocfft_precision_single ? sizeof(float) : sizeof(double);
+
+    FFTKernelGenKeyParams params;
+    std::vector<size_t>   fft_N(1, len);
+    if(scheme == CS_KERNEL_STOCKHAM_BLOCK_CC)
+    {
+        fft_N.push_back(1);
+        params.fft_3StepTwiddle = true;
+        initParams(params, fft_N, true, BCT_C2C);
+    }
+    else if(scheme == CS_KERNEL_STOCKHAM_BLOCK_RC)
+    {
+        fft_N.push_back(1);
+        params.fft_3StepTwiddle = false;
+        initParams(params, fft_N, true, BCT_R2C);
+    }
+    else
+        initParams(params, fft_N, false, BCT_C2C);
+
+    Kernel<rocfft_precision_single> kernel(params);
+
+    KernelMetadata metadata;
+    metadata.radices = kernel.radices;
+    // each complex element a thread holds takes two reals
+    metadata.registers = kernel.cnPerWI * 2 * realBytes / 4;
+    switch(scheme)
+    {
+    case CS_KERNEL_STOCKHAM:
+        metadata.workGroupSize = kernel.workGroupSize;
+        metadata.transforms    = kernel.numTrans;
+        metadata.ldsBytes      = kernel.SharedMemSize(false) * realBytes;
+        metadata.nonUnitStride = true;
+        break;
+    case CS_KERNEL_STOCKHAM_REAL:
+        // complex staging buffer + real butterfly scratch
+        metadata.workGroupSize = kernel.workGroupSize;
+        metadata.transforms    = kernel.numTrans;
+        metadata.ldsBytes      = 3 * len * kernel.numTrans * realBytes;
+        metadata.nonUnitStride = true;
+        break;
+    case CS_KERNEL_STOCKHAM_BLOCK_CC:
+    case CS_KERNEL_STOCKHAM_BLOCK_RC:
+        // LDS holds the whole block as complex elements
+        metadata.workGroupSize = kernel.blockWGS;
+        metadata.transforms    = kernel.blockWidth;
+        metadata.ldsBytes      = kernel.blockLDS * 2 * realBytes;
+        metadata.nonUnitStride = false;
+        break;
+    default:
+        abort();
+    }
+    return metadata;
+}
+
+static KernelMetadata
+    GetKernelMetadata2D(const std::tuple<size_t, size_t, ComputeScheme>& kernel,
+                        rocfft_precision                                 precision)
+{
+    const size_t realBytes = precision == rocfft_precision_single ? sizeof(float) : sizeof(double);
+
+    KernelCoreSpecs kcs;
+    auto GetWGSAndNT = [&kcs](size_t length, size_t& workGroupSize, size_t& numTransforms) {
+        return kcs.GetWGSAndNT(length, workGroupSize, numTransforms);
+    };
+
+    size_t        len0   = std::get<0>(kernel);
+    size_t        len1   = std::get<1>(kernel);
+    ComputeScheme scheme = std::get<2>(kernel);
+
+    // real kernels do their rows as half-length complex transforms,
+    // and keep the extra hermitian element of each row in LDS
+    size_t rowLength = len0;
+    size_t ldsRow    = len0;
+    if(scheme == CS_KERNEL_2D_SINGLE_REAL)
+    {
+        rowLength = len0 / 2;
+        ldsRow    = len0 / 2 + 1;
+    }
+
+    KernelMetadata metadata;
+    size_t         cnPerWI = 0;
+    for(size_t len : {rowLength, len1})
+    {
+        FFTKernelGenKeyParams params;
+        initParams(params, {len}, false, BCT_C2C);
+        Kernel<rocfft_precision_single> transform(params);
+        metadata.radices.insert(
+            metadata.radices.end(), transform.radices.begin(), transform.radices.end());
+        cnPerWI = std::max(cnPerWI, transform.cnPerWI);
+    }
+
+    metadata.workGroupSize = scheme == CS_KERNEL_2D_SINGLE
+                                 ? Get2DSingleThreadCount(len0, len1, GetWGSAndNT)
+                                 : Get2DSingleRealThreadCount(len0, len1, GetWGSAndNT);
+    metadata.transforms    = 1;
+    // semi-transformed data as complex elements, plus butterfly
+    // scratch in reals
+    metadata.ldsBytes      = 3 * ldsRow * len1 * realBytes;
+    metadata.registers     = cnPerWI * 2 * realBytes / 4;
+    metadata.nonUnitStride = true;
+    return metadata;
+}
+
+static std::vector<KernelMetadataEntry> CollectKernelMetadata(
+    const std::vector<size_t>&                                    support_list,
+    const std::vector<std::tuple<size_t, ComputeScheme>>&         large1D_list,
+    const std::vector<std::tuple<size_t, size_t, ComputeScheme>>& support_list_2D_single,
+    const std::vector<std::tuple<size_t, size_t, ComputeScheme>>& support_list_2D_double)
+{
+    std::vector<KernelMetadataEntry> entries;
+    for(auto precision : {rocfft_precision_single, rocfft_precision_double})
+    {
+        for(size_t len : support_list)
+        {
+            entries.push_back({{len},
+                               CS_KERNEL_STOCKHAM,
+                               precision,
+                               GetKernelMetadata(len, CS_KERNEL_STOCKHAM, precision)});
+            if(RealSingleSupported(len))
+                entries.push_back({{len},
+                                   CS_KERNEL_STOCKHAM_REAL,
+                                   precision,
+                                   GetKernelMetadata(len, CS_KERNEL_STOCKHAM_REAL, precision)});
+        }
+        for(const auto& kernel : large1D_list)
+        {
+            size_t        len    = std::get<0>(kernel);
+            ComputeScheme scheme = std::get<1>(kernel);
+            entries.push_back(
+                {{len}, scheme, precision, GetKernelMetadata(len, scheme, precision)});
+        }
+        const auto& list_2D = precision == rocfft_precision_single ? support_list_2D_single
+                                                                   : support_list_2D_double;
+        for(const auto& kernel : list_2D)
+            entries.push_back({{std::get<0>(kernel), std::get<1>(kernel)},
+                               std::get<2>(kernel),
+                               precision,
+                               GetKernelMetadata2D(kernel, precision)});
+    }
+    return entries;
+}
+
+static const char* SchemeName(ComputeScheme scheme)
+{
+    switch(scheme)
+    {
+    case CS_KERNEL_STOCKHAM:
+        return "CS_KERNEL_STOCKHAM";
+    case CS_KERNEL_STOCKHAM_REAL:
+        return "CS_KERNEL_STOCKHAM_REAL";
+    case CS_KERNEL_STOCKHAM_BLOCK_CC:
+        return "CS_KERNEL_STOCKHAM_BLOCK_CC";
+    case CS_KERNEL_STOCKHAM_BLOCK_RC:
+        return "CS_KERNEL_STOCKHAM_BLOCK_RC";
+    case CS_KERNEL_2D_SINGLE:
+        return "CS_KERNEL_2D_SINGLE";
+    case CS_KERNEL_2D_SINGLE_REAL:
+        return "CS_KERNEL_2D_SINGLE_REAL";
+    default:
+        abort();
+    }
+}
+
+// function pool statement that records the metadata of one kernel
+static std::string MetadataStatement(const KernelMetadataEntry& entry)
+{
+    std::ostringstream str;
+    str << "\tmetadata_map_"
+        << (entry.precision == rocfft_precision_single ? "single" : "double");
+    if(entry.lengths.size() == 1)
+        str << "[std::make_pair(" << entry.lengths[0] << ", ";
+    else
+        str << "_2D[std::make_tuple(" << entry.lengths[0] << ", " << entry.lengths[1] << ", ";
+    str << SchemeName(entry.scheme) << ")] = {{";
+    for(size_t i = 0; i < entry.metadata.radices.size(); ++i)
+        str << (i ? ", " : "") << entry.metadata.radices[i];
+    str << "}, " << entry.metadata.workGroupSize << ", " << entry.metadata.transforms << ", "
+        << entry.metadata.ldsBytes << ", " << entry.metadata.registers << ", "
+        << (entry.metadata.nonUnitStride ? "true" : "false") << "};\n";
+    return str.str();
+}
+
+// Structure of the code in one generated kernel file, counted over
+// all of its device functions.  LDS is indexed without a stride,
+// while global memory is always indexed with stride_in/stride_out.
+struct KernelCodeStats
+{
+    size_t barriers   = 0;
+    size_t ldsReads   = 0;
+    size_t ldsWrites  = 0;
+    size_t butterfly  = 0;
+    size_t twiddleMul = 0;
+};
+
+static KernelCodeStats CountKernelCode(const std::string& code)
+{
+    KernelCodeStats    stats;
+    std::istringstream lines(code);
+    std::string        line;
+    while(std::getline(lines, line))
+    {
+        auto first = line.find_first_not_of(" \t");
+        if(first == std::string::npos)
+            continue;
+
+        if(line.find("__syncthreads()") != std::string::npos)
+            ++stats.barriers;
+        if(line.find("Offset + (") != std::string::npos
+           && line.find("stride") == std::string::npos)
+        {
+            if(line.compare(first, 3, "buf") == 0 || line.compare(first, 3, "lds") == 0)
+                ++stats.ldsWrites;
+            else
+                ++stats.ldsReads;
+        }
+        if(line.compare(first, 6, "FwdRad") == 0 || line.compare(first, 6, "InvRad") == 0)
+            ++stats.butterfly;
+        if(line.find(" W = ") != std::string::npos)
+            ++stats.twiddleMul;
+    }
+    return stats;
+}
+
+// kernel files are written from several threads
+static std::mutex                             kernel_code_stats_mutex;
+static std::map<std::string, KernelCodeStats> kernel_code_stats;
+
+// Structural fingerprint of each generated kernel, one line per
+// kernel sorted by file, to be diffed against a checked-in baseline.
+// Device code is templated on precision, so only single precision
+// entries are listed.
+static void WriteKernelFingerprints(const std::string&                      fileName,
+                                    const std::vector<KernelMetadataEntry>& entries)
+{
+    std::vector<std::string> lines;
+    for(const auto& entry : entries)
+    {
+        if(entry.precision != rocfft_precision_single)
+            continue;
+
+        std::string kernelFile = "rocfft_kernel_";
+        switch(entry.scheme)
+        {
+        case CS_KERNEL_STOCKHAM:
+        case CS_KERNEL_STOCKHAM_REAL:
+            kernelFile += std::to_string(entry.lengths[0]);
+            break;
+        case CS_KERNEL_STOCKHAM_BLOCK_CC:
+            kernelFile += std::to_string(entry.lengths[0]) + "_sbcc";
+            break;
+        case CS_KERNEL_STOCKHAM_BLOCK_RC:
+            kernelFile += std::to_string(entry.lengths[0]) + "_sbrc";
+            break;
+        case CS_KERNEL_2D_SINGLE:
+            kernelFile += "2D_" + std::to_string(entry.lengths[0]) + "_"
+                          + std::to_string(entry.lengths[1]);
+            break;
+        case CS_KERNEL_2D_SINGLE_REAL:
+            kernelFile += "2D_real_" + std::to_string(entry.lengths[0]) + "_"
+                          + std::to_string(entry.lengths[1]);
+            break;
+        default:
+            abort();
+        }
+        kernelFile += ".h";
+
+        KernelCodeStats stats;
+        {
+            std::lock_guard<std::mutex> lock(kernel_code_stats_mutex);
+            auto                        s = kernel_code_stats.find(kernelFile);
+            if(s != kernel_code_stats.end())
+                stats = s->second;
+        }
+
+        std::ostringstream line;
+        line << kernelFile << " " << SchemeName(entry.scheme) << " radices=";
+        for(size_t i = 0; i < entry.metadata.radices.size(); ++i)
+            line << (i ? "," : "") << entry.metadata.radices[i];
+        line << " wgs=" << entry.metadata.workGroupSize << " trans=" << entry.metadata.transforms
+             << " lds_bytes=" << entry.metadata.ldsBytes << " regs=" << entry.metadata.registers
+             << " barriers=" << stats.barriers << " lds_reads=" << stats.ldsReads
+             << " lds_writes=" << stats.ldsWrites << " butterflies=" << stats.butterfly
+             << " twiddles=" << stats.twiddleMul;
+        lines.push_back(line.str());
+    }
+    std::sort(lines.begin(), lines.end());
+
+    std::string str = "# <kernel file> <scheme> <structure of the generated code>\n";
+    for(const auto& line : lines)
+        str += line + "\n";
+    WriteFileIfChanged(fileName, str);
+}
+
+// One JSON object per line, so that the file diffs well
+static void WriteKernelMetadataJSON(const std::string&                      fileName,
+                                    const std::vector<KernelMetadataEntry>& entries)
+{
+    std::ostringstream str;
+    str << "{\n  \"kernels\": [\n";
+    for(size_t e = 0; e < entries.size(); ++e)
+    {
+        const auto& entry = entries[e];
+        str << "    {\"lengths\": [";
+        for(size_t i = 0; i < entry.lengths.size(); ++i)
+            str << (i ? ", " : "") << entry.lengths[i];
+        str << "], \"scheme\": \"" << SchemeName(entry.scheme) << "\", \"precision\": \""
+            << (entry.precision == rocfft_precision_single ? "single" : "double")
+            << "\", \"radices\": [";
+        for(size_t i = 0; i < entry.metadata.radices.size(); ++i)
+            str << (i ? ", " : "") << entry.metadata.radices[i];
+        str << "], \"workgroup_size\": " << entry.metadata.workGroupSize
+            << ", \"transforms_per_block\": " << entry.metadata.transforms
+            << ", \"lds_bytes\": " << entry.metadata.ldsBytes
+            << ", \"registers\": " << entry.metadata.registers << ", \"strides\": [\"unit\""
+            << (entry.metadata.nonUnitStride ? ", \"nonunit\"" : "") << "]}"
+            << (e + 1 < entries.size() ? "," : "") << "\n";
+    }
+    str << "  ]\n}\n";
+    WriteFileIfChanged(fileName, str.str());
 }
 
 /* =====================================================================
@@ -569,6 +1034,15 @@ void AddCPUFunctionToPool(
         str += "\tfunction_map_single[std::make_pair(" + str_len
                + ",CS_KERNEL_STOCKHAM)] = &rocfft_internal_dfn_sp_ci_ci_stoc_";
         str += str_len + ";\n";
+        str += "\tcallback_map_single[std::make_pair(" + str_len
+               + ",CS_KERNEL_STOCKHAM)] = &rocfft_internal_dfn_sp_ci_ci_stoc_cb_";
+        str += str_len + ";\n";
+        if(RealSingleSupported(support_list[i]))
+        {
+            str += "\tfunction_map_single[std::make_pair(" + str_len
+                   + ",CS_KERNEL_STOCKHAM_REAL)] = &rocfft_internal_dfn_sp_real_stoc_";
+            str += str_len + ";\n";
+        }
     }
 
     str += "\n";
@@ -579,6 +1053,15 @@ void AddCPUFunctionToPool(
         str += "\tfunction_map_double[std::make_pair(" + str_len
                + ",CS_KERNEL_STOCKHAM)] = &rocfft_internal_dfn_dp_ci_ci_stoc_";
         str += str_len + ";\n";
+        str += "\tcallback_map_double[std::make_pair(" + str_len
+               + ",CS_KERNEL_STOCKHAM)] = &rocfft_internal_dfn_dp_ci_ci_stoc_cb_";
+        str += str_len + ";\n";
+        if(RealSingleSupported(support_list[i]))
+        {
+            str += "\tfunction_map_double[std::make_pair(" + str_len
+                   + ",CS_KERNEL_STOCKHAM_REAL)] = &rocfft_internal_dfn_dp_real_stoc_";
+            str += str_len + ";\n";
+        }
     }
 
     str += "\n";
@@ -647,6 +1130,13 @@ void AddCPUFunctionToPool(
                      "&rocfft_internal_dfn_sp_ci_ci_2D_"
                    + str_len_1 + "_" + str_len_2 + ";\n";
         }
+        else if(scheme == CS_KERNEL_2D_SINGLE_REAL)
+        {
+            str += "\tfunction_map_single_2D[std::make_tuple(" + str_len_1 + ", " + str_len_2
+                   + ", CS_KERNEL_2D_SINGLE_REAL)] = "
+                     "&rocfft_internal_dfn_sp_real_2D_"
+                   + str_len_1 + "_" + str_len_2 + ";\n";
+        }
         else
         {
             // not implemented yet!
@@ -665,6 +1155,13 @@ void AddCPUFunctionToPool(
                      "&rocfft_internal_dfn_dp_ci_ci_2D_"
                    + str_len_1 + "_" + str_len_2 + ";\n";
         }
+        else if(scheme == CS_KERNEL_2D_SINGLE_REAL)
+        {
+            str += "\tfunction_map_double_2D[std::make_tuple(" + str_len_1 + ", " + str_len_2
+                   + ", CS_KERNEL_2D_SINGLE_REAL)] = "
+                     "&rocfft_internal_dfn_dp_real_2D_"
+                   + str_len_1 + "_" + str_len_2 + ";\n";
+        }
         else
         {
             // not implemented yet!
@@ -672,29 +1169,24 @@ void AddCPUFunctionToPool(
         }
     }
 
+    auto metadata = CollectKernelMetadata(
+        support_list, large1D_list, support_list_2D_single, support_list_2D_double);
+
+    str += "\n";
+    str += "\t//kernel metadata \n";
+    for(const auto& entry : metadata)
+        str += MetadataStatement(entry);
+
     str += "}\n";
 
-    std::ofstream file;
-    std::string   headerFileName = "function_pool.cpp.h";
-    file.open(headerFileName);
+    WriteKernelMetadataJSON("rocfft_kernel_metadata.json", metadata);
+    WriteKernelFingerprints("rocfft_kernel_fingerprints.txt", metadata);
 
-    if(!file.is_open())
-    {
-        std::cout << "File: " << headerFileName << " could not be opened, exiting ...."
-                  << std::endl;
-    }
-    file << str;
-    file.close();
+    std::string headerFileName = "function_pool.cpp.h";
+    WriteFileIfChanged(headerFileName, str);
 
     std::string sourceFileName = "function_pool.cpp";
-    file.open(sourceFileName);
-    if(!file.is_open())
-    {
-        std::cout << "File: " << sourceFileName << " could not be opened, exiting ...."
-                  << std::endl;
-    }
-    file << "#include \"" << headerFileName << "\"";
-    file.close();
+    WriteFileIfChanged(sourceFileName, "#include \"" + headerFileName + "\"");
 }
 
 /* =====================================================================
@@ -703,21 +1195,53 @@ void AddCPUFunctionToPool(
 
 void WriteKernelToFile(std::string& str, std::string LEN)
 {
+    const std::string fileName = "rocfft_kernel_" + LEN + ".h";
 
-    std::ofstream file;
-    std::string   fileName = "rocfft_kernel_" + LEN + ".h";
-    file.open(fileName);
+    // multiple include protection
+    WriteFileIfChanged(fileName, "#pragma once\n" + str);
 
-    if(!file.is_open())
+    auto                        stats = CountKernelCode(str);
+    std::lock_guard<std::mutex> lock(kernel_code_stats_mutex);
+    kernel_code_stats[fileName] = stats;
+}
+
+/* =====================================================================
+    Write host C++ versions of the Stockham kernels, and a table of
+    them, to rocfft_host_kernels.h
+=================================================================== */
+
+void WriteHostKernels(const std::vector<size_t>& support_list)
+{
+    std::string str = "#pragma once\n#include \"rocfft_host_kernel_template.h\"\n";
+    std::string table;
+
+    for(size_t len : support_list)
     {
-        std::cout << "File: " << fileName << " could not be opened, exiting ...." << std::endl;
+        FFTKernelGenKeyParams params;
+        std::vector<size_t>   fft_N(1, len);
+        initParams(params, fft_N, false, BCT_C2C);
+
+        Kernel<rocfft_precision_single> kernel(params);
+        kernel.GenerateHostKernel(str);
+
+        const std::string lenStr = std::to_string(len);
+        table += "\t\t{" + lenStr + ", {";
+        for(size_t i = 0; i < kernel.radices.size(); ++i)
+            table += (i ? ", " : "") + std::to_string(kernel.radices[i]);
+        table += "}, &fft_fwd_host_len" + lenStr + "<T>, &fft_back_host_len" + lenStr + "<T>},\n";
     }
 
-    // multiple include protection
-    file << "#pragma once\n";
+    str += "\n// every generated host kernel, in the order of the kernel sizes\n";
+    str += "template <typename T>\n";
+    str += "const std::vector<HostKernel<T>>& host_kernels()\n";
+    str += "{\n";
+    str += "\tstatic const std::vector<HostKernel<T>> kernels = {\n";
+    str += table;
+    str += "\t};\n";
+    str += "\treturn kernels;\n";
+    str += "}\n";
 
-    file << str;
-    file.close();
+    WriteFileIfChanged("rocfft_host_kernels.h", str);
 }
 
 void generate_kernel(size_t len, ComputeScheme scheme)
@@ -737,6 +1261,21 @@ void generate_kernel(size_t len, ComputeScheme scheme)
             params); // generate data type template kernels regardless of precision
         kernel.GenerateKernel(programCode);
 
+        // fused real kernels reuse the device functions generated above
+        if(RealSingleSupported(len))
+        {
+            KernelRealSingle realKernel(params);
+            realKernel.GenerateRealKernel(programCode);
+        }
+
+        // variant that reads its input and writes its output through
+        // the plan's user callbacks
+        params.name_suffix         = "_cb";
+        params.fft_hasPreCallback  = true;
+        params.fft_hasPostCallback = true;
+        Kernel<rocfft_precision_single> callbackKernel(params);
+        callbackKernel.GenerateKernel(programCode);
+
         WriteKernelToFile(programCode, std::to_string(len));
     }
     else if(scheme == CS_KERNEL_STOCKHAM_BLOCK_CC)
@@ -777,46 +1316,65 @@ void generate_kernel(size_t len, ComputeScheme scheme)
         WriteKernelToFile(programCode, std::to_string(len) + params.name_suffix);
     }
 }
-void generate_2D_kernels(const std::vector<std::tuple<size_t, size_t, ComputeScheme>>& kernels)
+void generate_2D_kernel(const std::tuple<size_t, size_t, ComputeScheme>& dim)
 {
-    for(const auto& kernel : kernels)
-    {
-        std::string   programCode;
-        size_t        len1   = std::get<0>(kernel);
-        size_t        len2   = std::get<1>(kernel);
-        ComputeScheme scheme = std::get<2>(kernel);
+    std::string   programCode;
+    size_t        len1   = std::get<0>(dim);
+    size_t        len2   = std::get<1>(dim);
+    ComputeScheme scheme = std::get<2>(dim);
 
+    if(scheme == CS_KERNEL_2D_SINGLE)
+    {
         // if we were able to insert, this size must be new
         programCode += "#include \"rocfft_kernel_" + std::to_string(len1) + ".h\"\n";
         if(len1 != len2)
             programCode += "#include \"rocfft_kernel_" + std::to_string(len2) + ".h\"\n";
 
-        if(scheme == CS_KERNEL_2D_SINGLE)
-        {
-            // parameters for each dimension
-            FFTKernelGenKeyParams params1;
-            FFTKernelGenKeyParams params2;
-            // column-by-column transform can't possibly be unit stride
-            params2.forceNonUnitStride = true;
+        // parameters for each dimension
+        FFTKernelGenKeyParams params1;
+        FFTKernelGenKeyParams params2;
+        // column-by-column transform can't possibly be unit stride
+        params2.forceNonUnitStride = true;
+
+        std::vector<size_t> fft_N(1, len1);
+        // here the C2C is not enabled,
+        // as the third parameter is set
+        // as false
+        initParams(params1, fft_N, false, BCT_C2C);
+        fft_N.front() = len2;
+        initParams(params2, fft_N, false, BCT_C2C);
 
-            std::vector<size_t> fft_N(1, len1);
-            // here the C2C is not enabled,
-            // as the third parameter is set
-            // as false
-            initParams(params1, fft_N, false, BCT_C2C);
-            fft_N.front() = len2;
-            initParams(params2, fft_N, false, BCT_C2C);
+        Kernel2D kernel(params1, params2);
+        kernel.GenerateGlobalKernel(programCode);
 
-            Kernel2D kernel(params1, params2);
-            kernel.GenerateGlobalKernel(programCode);
+        std::string file_suffix = "2D_" + std::to_string(len1) + "_" + std::to_string(len2);
+        WriteKernelToFile(programCode, file_suffix);
+    }
+    else if(scheme == CS_KERNEL_2D_SINGLE_REAL)
+    {
+        // rows are done as half-length complex transforms
+        const size_t halfLen1 = len1 / 2;
+        programCode += "#include \"rocfft_kernel_" + std::to_string(halfLen1) + ".h\"\n";
+        if(halfLen1 != len2)
+            programCode += "#include \"rocfft_kernel_" + std::to_string(len2) + ".h\"\n";
 
-            std::string file_suffix = "2D_" + std::to_string(len1) + "_" + std::to_string(len2);
-            WriteKernelToFile(programCode, file_suffix);
-        }
-        else
-        {
-            // not handled yet
-            abort();
-        }
+        FFTKernelGenKeyParams params1;
+        FFTKernelGenKeyParams params2;
+
+        std::vector<size_t> fft_N(1, halfLen1);
+        initParams(params1, fft_N, false, BCT_C2C);
+        fft_N.front() = len2;
+        initParams(params2, fft_N, false, BCT_C2C);
+
+        KernelReal2D kernel(params1, params2);
+        kernel.GenerateRealKernel(programCode);
+
+        std::string file_suffix = "2D_real_" + std::to_string(len1) + "_" + std::to_string(len2);
+        WriteKernelToFile(programCode, file_suffix);
+    }
+    else
+    {
+        // not handled yet
+        abort();
     }
 }
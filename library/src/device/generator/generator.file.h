@@ -13,6 +13,14 @@ rocfft_status initParams(FFTKernelGenKeyParams& params,
                          bool                   blockCompute,
                          BlockComputeType       blockComputeType);
 
+// Write content to fileName, leaving the file untouched if it already
+// has exactly that content.  Safe to call from multiple threads.
+void WriteFileIfChanged(const std::string& fileName, const std::string& content);
+
+// Write a manifest of every file passed to WriteFileIfChanged, with a
+// hash of its content and the generated files it includes.
+void WriteGeneratedManifest(const std::string& fileName);
+
 void WriteButterflyToFile(std::string& str, int LEN);
 
 void WriteCPUHeaders(const std::vector<size_t>&                                    support_list,
@@ -35,8 +43,12 @@ void AddCPUFunctionToPool(
     const std::vector<std::tuple<size_t, size_t, ComputeScheme>>& support_list_2D_single,
     const std::vector<std::tuple<size_t, size_t, ComputeScheme>>& support_list_2D_double);
 
+// Write host C++ versions of the Stockham kernels of the given
+// lengths, and a table of them, to rocfft_host_kernels.h
+void WriteHostKernels(const std::vector<size_t>& support_list);
+
 void generate_kernel(size_t len, ComputeScheme scheme);
 
-void generate_2D_kernels(const std::vector<std::tuple<size_t, size_t, ComputeScheme>>& kernels);
+void generate_2D_kernel(const std::tuple<size_t, size_t, ComputeScheme>& dim);
 
 #endif // generator_file_H
@@ -625,6 +625,10 @@ namespace StockhamGenerator
                 {
                     GenerateSinglePassKernel(str, fwd, scale, inReal, outReal, true, true, p);
 
+                    // callbacks are only given interleaved data
+                    if(HasCallbacks())
+                        continue;
+
                     // TODO: double check the special cases sbrc and sbcc
                     if(!(name_suffix == "_sbrc" || name_suffix == "_sbcc"))
                     {
@@ -668,6 +672,9 @@ namespace StockhamGenerator
                     bool inInterleaved  = in;
                     bool outInterleaved = out;
 
+                    if(HasCallbacks() && !(inInterleaved && outInterleaved))
+                        continue;
+
                     // use interleaved LDS when halfLds constraint absent
                     bool ldsInterleaved = inInterleaved || outInterleaved;
                     ldsInterleaved      = halfLds ? false : ldsInterleaved;
@@ -703,6 +710,8 @@ namespace StockhamGenerator
                         str += "const size_t stride_in, const size_t stride_out, unsigned int "
                                "rw, unsigned int b, ";
                         str += "unsigned int me, unsigned int ldsOffset, ";
+                        if(HasCallbacks())
+                            str += "const UserCallbacks& cb, ";
 
                         if(inInterleaved)
                             str += r2Type + " *lwbIn, ";
@@ -752,6 +761,8 @@ namespace StockhamGenerator
 
                             // one more twiddle parameter
                             str += "stride_in, stride_out, rw, b, me, 0, 0,";
+                            if(HasCallbacks())
+                                str += " cb,";
 
                             if(inInterleaved)
                                 str += " lwbIn,";
@@ -819,6 +830,8 @@ namespace StockhamGenerator
                                     }
 
                                     str += "ldsOffset, ";
+                                    if(params.fft_hasPreCallback)
+                                        str += "cb, ";
                                     if(inInterleaved)
                                         str += " lwbIn, ";
                                     else
@@ -838,6 +851,8 @@ namespace StockhamGenerator
                                     {
                                         str += "0, ";
                                     }
+                                    if(params.fft_hasPostCallback)
+                                        str += "cb, ";
                                     str += ldsArgs;
 
                                     if(outInterleaved)
@@ -924,6 +939,19 @@ namespace StockhamGenerator
         {
             return false;
         }
+        // kernels launched by POWX_SMALL_GENERATOR also accept
+        // optional device arrays of per-batch buffer pointers
+        virtual bool BatchPointerParams()
+        {
+            return !blockCompute && !HasCallbacks();
+        }
+        // variants of the Stockham kernels that read their input
+        // and write their output through user callbacks, launched
+        // by POWX_SMALL_CALLBACK_GENERATOR
+        bool HasCallbacks() const
+        {
+            return params.fft_hasPreCallback || params.fft_hasPostCallback;
+        }
 
         void GenerateSingleGlobalKernelPrototype(std::string&            str,
                                                  bool                    fwd,
@@ -996,6 +1024,14 @@ namespace StockhamGenerator
                 str += "stride_out, ";
             }
             str += "const size_t batch_count, ";
+            if(BatchPointerParams())
+            {
+                str += "void * const * __restrict__ batch_in, ";
+                if(placeness == rocfft_placement_notinplace)
+                    str += "void * const * __restrict__ batch_out, ";
+            }
+            if(HasCallbacks())
+                str += "const UserCallbacks cb, ";
 
             // Function attributes
             if(placeness == rocfft_placement_inplace)
@@ -1170,21 +1206,17 @@ namespace StockhamGenerator
             {
                 str += "unsigned int ioOffset = 0;\n\t";
 
-                // Skip if callback is set
-                if(!params.fft_hasPreCallback || !params.fft_hasPostCallback)
+                if(inInterleaved)
                 {
-                    if(inInterleaved)
-                    {
-                        str += r2Type;
-                        str += " *lwb;\n";
-                    }
-                    else
-                    {
-                        str += rType;
-                        str += " *lwbRe;\n\t";
-                        str += rType;
-                        str += " *lwbIm;\n";
-                    }
+                    str += r2Type;
+                    str += " *lwb;\n";
+                }
+                else
+                {
+                    str += rType;
+                    str += " *lwbRe;\n\t";
+                    str += rType;
+                    str += " *lwbIm;\n";
                 }
                 str += "\n";
             }
@@ -1193,38 +1225,30 @@ namespace StockhamGenerator
                 str += "unsigned int iOffset = 0;\n\t";
                 str += "unsigned int oOffset = 0;\n\t";
 
-                // Skip if precallback is set
-                if(!(params.fft_hasPreCallback))
+                if(inInterleaved)
                 {
-                    if(inInterleaved)
-                    {
-                        str += r2Type;
-                        str += " *lwbIn;\n\t";
-                    }
-                    else
-                    {
-                        str += rType;
-                        str += " *lwbInRe;\n\t";
-                        str += rType;
-                        str += " *lwbInIm;\n\t";
-                    }
+                    str += r2Type;
+                    str += " *lwbIn;\n\t";
+                }
+                else
+                {
+                    str += rType;
+                    str += " *lwbInRe;\n\t";
+                    str += rType;
+                    str += " *lwbInIm;\n\t";
                 }
 
-                // Skip if postcallback is set
-                if(!params.fft_hasPostCallback)
+                if(outInterleaved)
                 {
-                    if(outInterleaved)
-                    {
-                        str += r2Type;
-                        str += " *lwbOut;\n";
-                    }
-                    else
-                    {
-                        str += rType;
-                        str += " *lwbOutRe;\n\t";
-                        str += rType;
-                        str += " *lwbOutIm;\n";
-                    }
+                    str += r2Type;
+                    str += " *lwbOut;\n";
+                }
+                else
+                {
+                    str += rType;
+                    str += " *lwbOutRe;\n\t";
+                    str += rType;
+                    str += " *lwbOutIm;\n";
                 }
                 str += "\n";
             }
@@ -1265,18 +1289,21 @@ namespace StockhamGenerator
             {
                 str += "\t";
 
-                // Skip if callback is set
-                if(!params.fft_hasPreCallback || !params.fft_hasPostCallback)
+                if(inInterleaved && BatchPointerParams())
                 {
-                    if(inInterleaved)
-                    {
-                        str += "lwb = gb + ioOffset;\n";
-                    }
-                    else
-                    {
-                        str += "lwbRe = gbRe + ioOffset;\n\t";
-                        str += "lwbIm = gbIm + ioOffset;\n";
-                    }
+                    // batch pointers are only given for 1D
+                    // transforms, where counter_mod is the batch
+                    str += "lwb = (batch_in && rw) ? (" + r2Type
+                           + "*)batch_in[counter_mod] : gb + ioOffset;\n";
+                }
+                else if(inInterleaved)
+                {
+                    str += "lwb = gb + ioOffset;\n";
+                }
+                else
+                {
+                    str += "lwbRe = gbRe + ioOffset;\n\t";
+                    str += "lwbIm = gbIm + ioOffset;\n";
                 }
                 str += "\n";
             }
@@ -1284,32 +1311,34 @@ namespace StockhamGenerator
             {
                 str += "\t";
 
-                // Skip if precallback is set
-                if(!(params.fft_hasPreCallback))
+                if(inInterleaved && BatchPointerParams())
                 {
-                    if(inInterleaved)
-                    {
-                        str += "lwbIn = gbIn + iOffset;\n\t";
-                    }
-                    else
-                    {
-                        str += "lwbInRe = gbInRe + iOffset;\n\t";
-                        str += "lwbInIm = gbInIm + iOffset;\n\t";
-                    }
+                    str += "lwbIn = (batch_in && rw) ? (" + r2Type
+                           + "*)batch_in[counter_mod] : gbIn + iOffset;\n\t";
+                }
+                else if(inInterleaved)
+                {
+                    str += "lwbIn = gbIn + iOffset;\n\t";
+                }
+                else
+                {
+                    str += "lwbInRe = gbInRe + iOffset;\n\t";
+                    str += "lwbInIm = gbInIm + iOffset;\n\t";
                 }
 
-                // Skip if postcallback is set
-                if(!params.fft_hasPostCallback)
+                if(outInterleaved && BatchPointerParams())
                 {
-                    if(outInterleaved)
-                    {
-                        str += "lwbOut = gbOut + oOffset;\n";
-                    }
-                    else
-                    {
-                        str += "lwbOutRe = gbOutRe + oOffset;\n\t";
-                        str += "lwbOutIm = gbOutIm + oOffset;\n";
-                    }
+                    str += "lwbOut = (batch_out && rw) ? (" + r2Type
+                           + "*)batch_out[counter_mod] : gbOut + oOffset;\n";
+                }
+                else if(outInterleaved)
+                {
+                    str += "lwbOut = gbOut + oOffset;\n";
+                }
+                else
+                {
+                    str += "lwbOutRe = gbOutRe + oOffset;\n\t";
+                    str += "lwbOutIm = gbOutIm + oOffset;\n";
                 }
                 str += "\n";
             }
@@ -1449,25 +1478,25 @@ namespace StockhamGenerator
             {
                 if(inInterleaved)
                 {
-                    inBuf  = params.fft_hasPreCallback ? "gb, " : "lwb, ";
-                    outBuf = params.fft_hasPostCallback ? "gb" : "lwb";
+                    inBuf  = "lwb, ";
+                    outBuf = "lwb";
                 }
                 else
                 {
-                    inBuf  = params.fft_hasPreCallback ? "gbRe, gbIm, " : "lwbRe, lwbIm, ";
-                    outBuf = params.fft_hasPostCallback ? "gbRe, gbIm" : "lwbRe, lwbIm";
+                    inBuf  = "lwbRe, lwbIm, ";
+                    outBuf = "lwbRe, lwbIm";
                 }
             }
             else
             {
                 if(inInterleaved)
-                    inBuf = params.fft_hasPreCallback ? "gbIn, " : "lwbIn, ";
+                    inBuf = "lwbIn, ";
                 else
-                    inBuf = params.fft_hasPreCallback ? "gbInRe, gbInIm, " : "lwbInRe, lwbInIm, ";
+                    inBuf = "lwbInRe, lwbInIm, ";
                 if(outInterleaved)
-                    outBuf = params.fft_hasPostCallback ? "gbOut" : "lwbOut";
+                    outBuf = "lwbOut";
                 else
-                    outBuf = params.fft_hasPostCallback ? "gbOutRe, gbOutIm" : "lwbOutRe, lwbOutIm";
+                    outBuf = "lwbOutRe, lwbOutIm";
             }
 
             /* =====================================================================
@@ -1555,6 +1584,8 @@ namespace StockhamGenerator
             str += rw;
             str += me;
             str += ldsOff + ", ";
+            if(HasCallbacks())
+                str += "cb, ";
 
             str += inBuf + outBuf;
 
@@ -1711,6 +1742,14 @@ namespace StockhamGenerator
         {
             str += "\n////////////////////////////////////////Global kernels\n";
 
+            // callbacks are only given interleaved data
+            if(HasCallbacks())
+            {
+                GenerateSingleGlobalKernel(str, rocfft_placement_inplace, true, true);
+                GenerateSingleGlobalKernel(str, rocfft_placement_notinplace, true, true);
+                return;
+            }
+
             // inplace, support only: interleaved to interleaved, planar to planar
             GenerateSingleGlobalKernel(str, rocfft_placement_inplace, true, true);
             GenerateSingleGlobalKernel(str, rocfft_placement_inplace, false, false);
@@ -1772,9 +1811,8 @@ namespace StockhamGenerator
             // use blocked columns to compute FFTs
             if(blockCompute)
             {
-                assert(length <= 256); // 256 parameter comes from prototype experiments
-                // largest length at which block column possible given 32KB LDS limit
-                // if LDS limit is different this number need to be changed appropriately
+                // the generator only asks for lengths whose block fits
+                // in LDS, see GetBlockComputeSizes
                 halfLds    = false;
                 linearRegs = true;
             }
@@ -1797,9 +1835,10 @@ namespace StockhamGenerator
 
             // See if we can get radices from the lookup table, only part of pow2 is in
             // the table
-            KernelCoreSpecs     kcs;
-            std::vector<size_t> radices = kcs.GetRadices(length);
-            size_t              nPasses = radices.size();
+            // (the chosen radices are kept for the kernel metadata)
+            KernelCoreSpecs kcs;
+            radices        = kcs.GetRadices(length);
+            size_t nPasses = radices.size();
 
             if((params.fft_MaxWorkGroupSize >= 256) && (nPasses != 0))
             {
@@ -1834,36 +1873,14 @@ namespace StockhamGenerator
             else
             {
                 // printf("generating radix sequences\n");
+                radices = DetermineRadices(length, cnPerWI);
 
-                // Possible radices
-                size_t cRad[] = {13, 11, 10, 8, 7, 6, 5, 4, 3, 2, 1}; // Must be in descending order
-                size_t cRadSize = (sizeof(cRad) / sizeof(cRad[0]));
-
-                // Generate the radix and pass objects
-                while(true)
+                // Generate the pass objects
+                for(size_t rad : radices)
                 {
-                    size_t rad;
-
-                    assert(cRadSize >= 1);
-
-                    // Picks the radices in descending order (biggest radix first)
-                    for(size_t r = 0; r < cRadSize; r++)
-                    {
-                        rad = cRad[r];
-
-                        if((rad > cnPerWI) || (cnPerWI % rad))
-                            continue;
-
-                        if(!(R % rad))
-                            break;
-                    }
-
-                    assert((cnPerWI % rad) == 0);
-
                     L = LS * rad;
                     R /= rad;
 
-                    radices.push_back(rad);
                     passes.push_back(Pass<PR>(pid,
                                               length,
                                               rad,
@@ -1881,11 +1898,8 @@ namespace StockhamGenerator
 
                     pid++;
                     LS *= rad;
-
-                    assert(R >= 1);
-                    if(R == 1)
-                        break;
-                } // end while
+                }
+                assert(R == 1);
                 numPasses = pid;
             }
 
@@ -1929,9 +1943,23 @@ namespace StockhamGenerator
                 for(size_t i = 0; i < (numPasses - 1); i++)
                     passes[i].SetNextPass(&passes[i + 1]);
 
+            // the first pass reads the kernel input, and the last
+            // writes its output
+            if(HasCallbacks())
+            {
+                assert(!blockCompute && !r2c2r);
+                passes.front().SetPrecallback(params.fft_hasPreCallback);
+                passes.back().SetPostcallback(params.fft_hasPostCallback);
+            }
+
             if(blockCompute)
             {
-                BlockSizes::GetValue(length, blockWidth, blockWGS, blockLDS);
+                // each column of the block is done by the threads of
+                // one transform of the Stockham kernel
+                bool hasBlock = GetBlockComputeSizes(
+                    length, workGroupSizePerTrans, blockWidth, blockWGS, blockLDS);
+                assert(hasBlock);
+                (void)hasBlock;
             }
             else
             {
@@ -1939,38 +1967,12 @@ namespace StockhamGenerator
             }
         } // end of if ((params.fft_MaxWorkGroupSize >= 256) && (nPasses != 0))
 
-        class BlockSizes
-        {
-        public:
-            static void GetValue(size_t N, size_t& bwd, size_t& wgs, size_t& lds)
-            {
-                // wgs preferred work group size
-                // bwd block width to be used
-                // lds LDS size to be used for the block
-
-                GetBlockComputeTable(N, bwd, wgs, lds);
-
-                /*
-                // bwd > t_nt is always ture, TODO: remove
-                KernelCoreSpecs kcs;
-                size_t t_wgs, t_nt;
-                kcs.GetWGSAndNT(N, t_wgs, t_nt);
-                wgs =  (bwd > t_nt) ? wgs : t_wgs;
-                */
-
-                // printf("N=%d, bwd=%d, wgs=%d, lds=%d\n", N, bwd, wgs, lds);
-                // block width cannot be less than numTrans, math in other parts of code
-                // depend on this assumption
-                // assert(bwd >= t_nt);
-            }
-        };
-
         /* =====================================================================
             This is the main entrance to generate all device code.
             Notes:
                 In this GenerateKernel function
                 Real2Complex Complex2Real features are not available
-                Callback features are not available
+                Callbacks are only available for complex Stockham kernels
             =================================================================== */
         void GenerateKernel(std::string& str)
         {
@@ -1983,6 +1985,59 @@ namespace StockhamGenerator
 
             GenerateGlobalKernel(str);
         }
+
+        /* =====================================================================
+            Generate the host C++ version of a complex Stockham kernel:
+            fft_fwd_host_lenN and fft_back_host_lenN do a batch of
+            transforms with the same passes and twiddle table as the
+            device kernel, one pass at a time on the calling thread.
+            =================================================================== */
+        void GenerateHostKernel(std::string& str)
+        {
+            assert(!blockCompute && !r2c2r);
+
+            for(bool fwd : {true, false})
+            {
+                const std::string name = std::string(fwd ? "fft_fwd_host_len" : "fft_back_host_len")
+                                         + std::to_string(length) + name_suffix;
+
+                str += "\ntemplate <typename T>\n";
+                str += "void " + name + "(const T* twiddles, size_t batch, const T* in, "
+                       + "size_t stride_in, size_t dist_in, T* out, size_t stride_out, "
+                       + "size_t dist_out)\n";
+                str += "{\n";
+
+                // passes alternate between two work buffers, the first
+                // reads the input and the last writes the output
+                if(numPasses > 1)
+                {
+                    str += "\tstd::vector<T> work(" + std::to_string(2 * length) + ");\n";
+                    str += "\tT* bufA = work.data();\n";
+                    str += "\tT* bufB = bufA + " + std::to_string(length) + ";\n";
+                }
+
+                str += "\tfor(size_t t = 0; t < batch; ++t)\n";
+                str += "\t{\n";
+                str += "\t\tconst T* x = in + t * dist_in;\n";
+                str += "\t\tT* y = out + t * dist_out;\n";
+
+                for(size_t p = 0; p < numPasses; p++)
+                {
+                    const bool first = (p == 0);
+                    const bool last  = (p + 1 == numPasses);
+
+                    passes[p].GenerateHostPass(fwd,
+                                               first ? "x" : (p % 2 ? "bufA" : "bufB"),
+                                               first ? " * stride_in" : "",
+                                               last ? "y" : (p % 2 ? "bufB" : "bufA"),
+                                               last ? " * stride_out" : "",
+                                               str);
+                }
+
+                str += "\t}\n";
+                str += "}\n";
+            }
+        }
     };
 
     // Single pass of a 2D_SINGLE kernel, either to do row transform or
@@ -2030,6 +2085,13 @@ namespace StockhamGenerator
             Kernel<rocfft_precision_single>::GenerateSingleGlobalKernelIOOffsets(str, placeness);
             std::swap(temp, numTrans);
         }
+
+        // transforms are done to/from LDS, per-batch pointers are
+        // resolved by the enclosing 2D kernel
+        bool BatchPointerParams() override
+        {
+            return false;
+        }
         bool isRowTransform;
     };
     // Generate 2D kernels.  Thus far, we're only generating templated
@@ -2252,6 +2314,509 @@ namespace StockhamGenerator
         Kernel2D_SINGLE_pass transform_row;
         Kernel2D_SINGLE_pass transform_col;
     };
+
+    // Generate fused real-to-complex and complex-to-real kernels for
+    // odd lengths.  Each threadblock stages its transforms in LDS as
+    // complex data, runs the usual in-place Stockham passes on LDS,
+    // and writes only the non-redundant half of the result.  Like
+    // the 2D kernels, these are templated and don't care about
+    // precision.
+    class KernelRealSingle : public Kernel<rocfft_precision_single>
+    {
+    public:
+        KernelRealSingle(const FFTKernelGenKeyParams& paramsVal)
+            : Kernel(paramsVal)
+        {
+        }
+
+        void GenerateSingleGlobalKernelRWFlag(std::string& str) override
+        {
+            // LDS is sized for numTrans transforms, so every thread can
+            // safely work on it - only global reads and writes need to
+            // be guarded
+            str += "\tunsigned int rw = 1;\n";
+            str += "\t(void)rw;\n";
+        }
+
+        void GenerateSingleGlobalKernelIOOffsets(std::string&            str,
+                                                 rocfft_result_placement placeness) override
+        {
+            // HACK: the transforms are done in LDS, which only holds
+            // this threadblock's transforms.  Convince the IO offset
+            // generating code to assume everything is batch zero,
+            // same as Kernel2D_SINGLE_pass does.
+            size_t temp = 0;
+            std::swap(temp, numTrans);
+            Kernel<rocfft_precision_single>::GenerateSingleGlobalKernelIOOffsets(str, placeness);
+            std::swap(temp, numTrans);
+        }
+
+        // real kernels have their own prototype without batch pointers
+        bool BatchPointerParams() override
+        {
+            return false;
+        }
+
+        void GenerateRealKernel(std::string& str)
+        {
+            str += "\n////////////////////////////////////////Real kernels\n";
+
+            std::string rType  = RegBaseType<rocfft_precision_single>(1);
+            std::string r2Type = RegBaseType<rocfft_precision_single>(2);
+
+            // r2c: real input, interleaved or planar hermitian output
+            GenerateRealGlobalKernel(str, true, true, rType, r2Type);
+            GenerateRealGlobalKernel(str, true, false, rType, r2Type);
+            // c2r: interleaved or planar hermitian input, real output
+            GenerateRealGlobalKernel(str, false, true, rType, r2Type);
+            GenerateRealGlobalKernel(str, false, false, rType, r2Type);
+        }
+
+    private:
+        // generate statements that compute the offset of the transform
+        // "counter_mod" in a global buffer, from the user's lengths and
+        // strides (distance is at index dim)
+        std::string RealOffsetCalc(const std::string& offset_name, const std::string& stride_name)
+        {
+            std::string str;
+            str += "\t\t\tsize_t " + offset_name + " = 0;\n";
+            str += "\t\t\tfor(int i = dim; i > 1; i--)\n";
+            str += "\t\t\t{\n";
+            str += "\t\t\t\tsize_t currentLength = 1;\n";
+            str += "\t\t\t\tfor(int j = 1; j < i; j++)\n";
+            str += "\t\t\t\t\tcurrentLength *= _lengths[j];\n";
+            str += "\t\t\t\t" + offset_name + " += (counter_mod / currentLength) * " + stride_name
+                   + "[i];\n";
+            str += "\t\t\t\tcounter_mod = counter_mod % currentLength;\n";
+            str += "\t\t\t}\n";
+            str += "\t\t\t" + offset_name + " += counter_mod * " + stride_name + "[1];\n";
+            return str;
+        }
+
+        // generate the start of a loop over this threadblock's share of
+        // "count" elements per transform, skipping transforms past the
+        // end of the batch
+        std::string RealLoopBegin(size_t count)
+        {
+            std::string str;
+            str += "\tfor(unsigned int t = me; t < " + std::to_string(count * numTrans)
+                   + "; t += " + std::to_string(workGroupSize) + ")\n";
+            str += "\t{\n";
+            str += "\t\tsize_t counter_mod = batch * " + std::to_string(numTrans) + " + t / "
+                   + std::to_string(count) + ";\n";
+            str += "\t\tconst size_t idx = t % " + std::to_string(count) + ";\n";
+            str += "\t\tconst size_t ldsIdx = (t / " + std::to_string(count) + ") * "
+                   + std::to_string(length) + " + idx;\n";
+            str += "\t\tif(counter_mod < upper_count)\n";
+            str += "\t\t{\n";
+            return str;
+        }
+
+        void GenerateRealGlobalKernel(std::string&       str,
+                                      bool               fwd,
+                                      bool               hermInterleaved,
+                                      const std::string& rType,
+                                      const std::string& r2Type)
+        {
+            const size_t hermLength = length / 2 + 1;
+
+            str += "//Kernel configuration: number of threads per thread block: ";
+            str += std::to_string(workGroupSize) + ", maximum transforms: ";
+            str += std::to_string(numTrans) + ", Passes: " + std::to_string(numPasses) + "\n";
+            str += "template <typename T, StrideBin sb>\n";
+            str += "__global__ void\n";
+            str += LaunchBounds();
+            str += fwd ? "fft_fwd" : "fft_back";
+            str += "_len" + std::to_string(length) + (fwd ? "_r2c" : "_c2r");
+            str += "( const " + r2Type + " * __restrict__ twiddles, const size_t dim, ";
+            str += "const size_t *_lengths, const size_t *_stride_in, const size_t *_stride_out, ";
+            str += "const size_t batch_count, ";
+
+            // no __restrict__ on user buffers, since the same kernel
+            // also serves in-place transforms
+            if(fwd)
+                str += "const " + rType + " *_gbIn, ";
+            else if(hermInterleaved)
+                str += "const " + r2Type + " *_gbIn, ";
+            else
+                str += "const " + rType + " *_gbInRe, const " + rType + " *_gbInIm, ";
+            if(!fwd)
+                str += rType + " *_gbOut)\n";
+            else if(hermInterleaved)
+                str += r2Type + " *_gbOut)\n";
+            else
+                str += rType + " *_gbOutRe, " + rType + " *_gbOutIm)\n";
+            str += "{\n";
+
+            GenerateSingleGlobalKernelSharedMem(
+                str, false, rocfft_placement_inplace, rType, r2Type);
+            str += "\t__shared__ T lds_data[" + std::to_string(length * numTrans) + "];\n\n";
+
+            str += "\tunsigned int me = (unsigned int)hipThreadIdx_x;\n";
+            str += "\tunsigned int batch = (unsigned int)hipBlockIdx_x;\n\n";
+
+            str += "\t// higher dimensions are flattened into the batch\n";
+            str += "\tsize_t upper_count = batch_count;\n";
+            str += "\tfor(int i = 1; i < dim; i++)\n";
+            str += "\t\tupper_count *= _lengths[i];\n\n";
+
+            if(fwd)
+            {
+                str += "\t// load real input into LDS, with zero imaginary part\n";
+                str += RealLoopBegin(length);
+                str += RealOffsetCalc("iOffset", "_stride_in");
+                str += "\t\t\tlds_data[ldsIdx].x = _gbIn[iOffset + idx * _stride_in[0]];\n";
+                str += "\t\t\tlds_data[ldsIdx].y = 0;\n";
+                str += "\t\t}\n";
+                str += "\t}\n";
+            }
+            else
+            {
+                str += "\t// expand hermitian input into a full complex sequence in\n";
+                str += "\t// LDS, using conjugate symmetry for the upper half\n";
+                str += RealLoopBegin(length);
+                str += RealOffsetCalc("iOffset", "_stride_in");
+                str += "\t\t\tconst bool   lower = idx < " + std::to_string(hermLength) + ";\n";
+                str += "\t\t\tconst size_t inIdx = iOffset + (lower ? idx : "
+                       + std::to_string(length) + " - idx) * _stride_in[0];\n";
+                if(hermInterleaved)
+                {
+                    str += "\t\t\tT val = _gbIn[inIdx];\n";
+                }
+                else
+                {
+                    str += "\t\t\tT val;\n";
+                    str += "\t\t\tval.x = _gbInRe[inIdx];\n";
+                    str += "\t\t\tval.y = _gbInIm[inIdx];\n";
+                }
+                str += "\t\t\tif(!lower)\n";
+                str += "\t\t\t\tval.y = -val.y;\n";
+                str += "\t\t\tlds_data[ldsIdx] = val;\n";
+                str += "\t\t}\n";
+                str += "\t}\n";
+            }
+            str += "\t__syncthreads();\n\n";
+
+            str += "\t// transform in place in LDS\n";
+            str += "\t{\n";
+            str += "\t\tconst size_t dim = 1;\n";
+            str += "\t\tconst size_t* lengths = _lengths;\n";
+            str += "\t\tconst size_t stride_in[2] = {1, " + std::to_string(length) + "};\n";
+            str += "\t\tT* gb = lds_data;\n";
+            Kernel<rocfft_precision_single>::GenerateSingleGlobalKernelBody(
+                str, fwd, rocfft_placement_inplace, true, true, rType, r2Type);
+            str += "\t}\n";
+            str += "\t__syncthreads();\n\n";
+
+            if(fwd)
+            {
+                str += "\t// write the non-redundant half of the result\n";
+                str += RealLoopBegin(hermLength);
+                str += RealOffsetCalc("oOffset", "_stride_out");
+                if(hermInterleaved)
+                {
+                    str += "\t\t\t_gbOut[oOffset + idx * _stride_out[0]] = lds_data[ldsIdx];\n";
+                }
+                else
+                {
+                    str += "\t\t\t_gbOutRe[oOffset + idx * _stride_out[0]] = lds_data[ldsIdx].x;\n";
+                    str += "\t\t\t_gbOutIm[oOffset + idx * _stride_out[0]] = lds_data[ldsIdx].y;\n";
+                }
+            }
+            else
+            {
+                str += "\t// write the real part of the result\n";
+                str += RealLoopBegin(length);
+                str += RealOffsetCalc("oOffset", "_stride_out");
+                str += "\t\t\t_gbOut[oOffset + idx * _stride_out[0]] = lds_data[ldsIdx].x;\n";
+            }
+            str += "\t\t}\n";
+            str += "\t}\n";
+            str += "}\n\n";
+        }
+    };
+
+    // Generate fused real 2D kernels for an even first dimension.
+    // The real rows are read as half-length complex sequences into
+    // LDS, and the row transform, the even-length post-processing
+    // (or pre-processing for inverse) and the column transform all
+    // run on LDS, so the data makes one round trip to global memory.
+    // The row and column transforms reuse the complex device
+    // functions, so this doesn't care about precision either.
+    class KernelReal2D
+    {
+    public:
+        // paramsVal1 describes the half-length row transform,
+        // paramsVal2 the column transform
+        KernelReal2D(const FFTKernelGenKeyParams& paramsVal1,
+                     const FFTKernelGenKeyParams& paramsVal2)
+            : transform_row(paramsVal1)
+            , transform_col(paramsVal2)
+        {
+        }
+
+        void GenerateRealKernel(std::string& str)
+        {
+            str += "\n////////////////////////////////////////Real 2D kernels\n";
+
+            std::string rType  = RegBaseType<rocfft_precision_single>(1);
+            std::string r2Type = RegBaseType<rocfft_precision_single>(2);
+
+            // r2c: real input, interleaved or planar hermitian output
+            GenerateRealGlobalKernel(str, true, true, rType, r2Type);
+            GenerateRealGlobalKernel(str, true, false, rType, r2Type);
+            // c2r: interleaved or planar hermitian input, real output
+            GenerateRealGlobalKernel(str, false, true, rType, r2Type);
+            GenerateRealGlobalKernel(str, false, false, rType, r2Type);
+        }
+
+    private:
+        // number of threads needed to do every row or every column
+        // transform at once
+        size_t WorkGroupSize()
+        {
+            const size_t hermLength = transform_row.length + 1;
+            return std::max(transform_col.length * transform_row.workGroupSizePerTrans,
+                            hermLength * transform_col.workGroupSizePerTrans);
+        }
+
+        // generate the start of a loop over this threadblock's share
+        // of a rows x cols block of LDS
+        std::string RealLoopBegin(size_t rows, size_t cols)
+        {
+            std::string str;
+            str += "\tfor(unsigned int t = me; t < " + std::to_string(rows * cols)
+                   + "; t += " + std::to_string(WorkGroupSize()) + ")\n";
+            str += "\t{\n";
+            str += "\t\tconst size_t row = t / " + std::to_string(cols) + ";\n";
+            str += "\t\tconst size_t col = t % " + std::to_string(cols) + ";\n";
+            return str;
+        }
+
+        // generate a call to the device function of "transform" for
+        // each of "count" transforms in LDS, in place
+        std::string DeviceCall(Kernel<rocfft_precision_single>& transform,
+                               bool                             fwd,
+                               size_t                           count,
+                               size_t                           stride,
+                               size_t                           dist,
+                               const std::string&               twiddles)
+        {
+            const std::string wgpt = std::to_string(transform.workGroupSizePerTrans);
+            const std::string sb   = stride == 1 ? "SB_UNIT" : "SB_NONUNIT";
+
+            std::string str;
+            str += "\t{\n";
+            str += "\t\tunsigned int rw = me < " + std::to_string(count) + " * " + wgpt + ";\n";
+            str += "\t\tT* lwb = lds_data + (me / " + wgpt + ") * " + std::to_string(dist) + ";\n";
+            str += "\t\t" + std::string(fwd ? "fwd" : "back") + "_len"
+                   + std::to_string(transform.length) + "_device<T, " + sb + ">(" + twiddles
+                   + ", " + std::to_string(stride) + ", " + std::to_string(stride)
+                   + ", rw, 0, me % " + wgpt + ", (me / " + wgpt + ") * "
+                   + std::to_string(transform.length) + ", lwb, lwb, lds);\n";
+            str += "\t}\n";
+            str += "\t__syncthreads();\n\n";
+            return str;
+        }
+
+        void GenerateRealGlobalKernel(std::string&       str,
+                                      bool               fwd,
+                                      bool               hermInterleaved,
+                                      const std::string& rType,
+                                      const std::string& r2Type)
+        {
+            const size_t halfLength = transform_row.length;
+            const size_t hermLength = halfLength + 1;
+            const size_t quarter    = hermLength / 2;
+            const size_t length1    = transform_col.length;
+
+            // twiddle tables for the row transform, the column
+            // transform (if nonsquare) and the real post/pre-processing
+            // are back to back in device memory
+            const size_t colTwiddleOffset = halfLength == length1 ? 0 : halfLength;
+            const size_t realTwiddleOffset
+                = halfLength == length1 ? halfLength : halfLength + length1;
+
+            str += "//Kernel configuration: number of threads per thread block: ";
+            str += std::to_string(WorkGroupSize()) + "\n";
+            str += "template <typename T, StrideBin sb>\n";
+            str += "__global__ void\n";
+            str += "__launch_bounds__(" + std::to_string(WorkGroupSize()) + ")\n";
+            str += fwd ? "fft_fwd" : "fft_back";
+            str += "_2D_" + std::to_string(2 * halfLength) + "_" + std::to_string(length1);
+            str += fwd ? "_r2c" : "_c2r";
+            str += "( const " + r2Type + " * __restrict__ twiddles, const size_t dim, ";
+            str += "const size_t *_lengths, const size_t *_stride_in, const size_t *_stride_out, ";
+            str += "const size_t batch_count, ";
+
+            // no __restrict__ on user buffers, since the same kernel
+            // also serves in-place transforms
+            if(fwd)
+                str += "const " + rType + " *_gbIn, ";
+            else if(hermInterleaved)
+                str += "const " + r2Type + " *_gbIn, ";
+            else
+                str += "const " + rType + " *_gbInRe, const " + rType + " *_gbInIm, ";
+            if(!fwd)
+                str += rType + " *_gbOut)\n";
+            else if(hermInterleaved)
+                str += r2Type + " *_gbOut)\n";
+            else
+                str += rType + " *_gbOutRe, " + rType + " *_gbOutIm)\n";
+            str += "{\n";
+
+            // rows are stored in LDS with room for the extra
+            // hermitian element; butterfly scratch covers the larger
+            // of the row and column transforms
+            str += "\t__shared__ " + rType + " lds[" + std::to_string(hermLength * length1)
+                   + "];\n";
+            str += "\t__shared__ T lds_data[" + std::to_string(hermLength * length1) + "];\n\n";
+
+            str += "\tunsigned int me = (unsigned int)hipThreadIdx_x;\n";
+            str += "\tunsigned int batch = (unsigned int)hipBlockIdx_x;\n\n";
+
+            str += "\tconst T* twiddles_col = twiddles + " + std::to_string(colTwiddleOffset)
+                   + ";\n";
+            str += "\tconst T* twiddles_real = twiddles + " + std::to_string(realTwiddleOffset)
+                   + ";\n\n";
+
+            if(fwd)
+            {
+                str += "\t// load each real row into LDS as a half-length complex row\n";
+                str += RealLoopBegin(length1, halfLength);
+                str += "\t\tconst size_t iOffset = batch * _stride_in[2] + row * _stride_in[1] "
+                       "+ 2 * col * _stride_in[0];\n";
+                str += "\t\tlds_data[row * " + std::to_string(hermLength)
+                       + " + col].x = _gbIn[iOffset];\n";
+                str += "\t\tlds_data[row * " + std::to_string(hermLength)
+                       + " + col].y = _gbIn[iOffset + _stride_in[0]];\n";
+                str += "\t}\n";
+                str += "\t__syncthreads();\n\n";
+
+                str += "\t// transform each row\n";
+                str += DeviceCall(transform_row, true, length1, 1, hermLength, "twiddles");
+
+                str += "\t// post-process each row into its " + std::to_string(hermLength)
+                       + " hermitian outputs\n";
+                str += RealLoopBegin(length1, quarter);
+                str += "\t\tT* lwb = lds_data + row * " + std::to_string(hermLength) + ";\n";
+                str += "\t\tif(col == 0)\n";
+                str += "\t\t{\n";
+                str += "\t\t\tconst T p = lwb[0];\n";
+                str += "\t\t\tlwb[" + std::to_string(halfLength) + "].x = p.x - p.y;\n";
+                str += "\t\t\tlwb[" + std::to_string(halfLength) + "].y = 0;\n";
+                str += "\t\t\tlwb[0].x = p.x + p.y;\n";
+                str += "\t\t\tlwb[0].y = 0;\n";
+                if(halfLength % 2 == 0)
+                    str += "\t\t\tlwb[" + std::to_string(quarter) + "].y = -lwb["
+                           + std::to_string(quarter) + "].y;\n";
+                str += "\t\t}\n";
+                str += "\t\telse\n";
+                str += "\t\t{\n";
+                str += "\t\t\tconst size_t idx_q = " + std::to_string(halfLength) + " - col;\n";
+                str += "\t\t\tconst T p = lwb[col];\n";
+                str += "\t\t\tconst T q = lwb[idx_q];\n";
+                str += "\t\t\tconst T u = 0.5 * (p + q);\n";
+                str += "\t\t\tconst T v = 0.5 * (p - q);\n";
+                str += "\t\t\tconst T twd_p = twiddles_real[col];\n";
+                str += "\t\t\tlwb[col].x = u.x + v.x * twd_p.y + u.y * twd_p.x;\n";
+                str += "\t\t\tlwb[col].y = v.y + u.y * twd_p.y - v.x * twd_p.x;\n";
+                str += "\t\t\tlwb[idx_q].x = u.x - v.x * twd_p.y - u.y * twd_p.x;\n";
+                str += "\t\t\tlwb[idx_q].y = -v.y + u.y * twd_p.y - v.x * twd_p.x;\n";
+                str += "\t\t}\n";
+                str += "\t}\n";
+                str += "\t__syncthreads();\n\n";
+
+                str += "\t// transform each hermitian column\n";
+                str += DeviceCall(transform_col, true, hermLength, hermLength, 1, "twiddles_col");
+
+                str += "\t// write the hermitian result\n";
+                str += RealLoopBegin(length1, hermLength);
+                str += "\t\tconst size_t oOffset = batch * _stride_out[2] + row * _stride_out[1] "
+                       "+ col * _stride_out[0];\n";
+                if(hermInterleaved)
+                {
+                    str += "\t\t_gbOut[oOffset] = lds_data[t];\n";
+                }
+                else
+                {
+                    str += "\t\t_gbOutRe[oOffset] = lds_data[t].x;\n";
+                    str += "\t\t_gbOutIm[oOffset] = lds_data[t].y;\n";
+                }
+                str += "\t}\n";
+            }
+            else
+            {
+                str += "\t// load the hermitian input into LDS\n";
+                str += RealLoopBegin(length1, hermLength);
+                str += "\t\tconst size_t iOffset = batch * _stride_in[2] + row * _stride_in[1] "
+                       "+ col * _stride_in[0];\n";
+                if(hermInterleaved)
+                {
+                    str += "\t\tlds_data[t] = _gbIn[iOffset];\n";
+                }
+                else
+                {
+                    str += "\t\tlds_data[t].x = _gbInRe[iOffset];\n";
+                    str += "\t\tlds_data[t].y = _gbInIm[iOffset];\n";
+                }
+                str += "\t}\n";
+                str += "\t__syncthreads();\n\n";
+
+                str += "\t// transform each hermitian column\n";
+                str += DeviceCall(transform_col, false, hermLength, hermLength, 1, "twiddles_col");
+
+                str += "\t// pre-process each row into a half-length complex row\n";
+                str += RealLoopBegin(length1, quarter);
+                str += "\t\tT* lwb = lds_data + row * " + std::to_string(hermLength) + ";\n";
+                str += "\t\tconst size_t idx_q = " + std::to_string(halfLength) + " - col;\n";
+                str += "\t\tconst T p = lwb[col];\n";
+                str += "\t\tconst T q = lwb[idx_q];\n";
+                str += "\t\tif(col == 0)\n";
+                str += "\t\t{\n";
+                str += "\t\t\tlwb[0].x = p.x - p.y + q.x + q.y;\n";
+                str += "\t\t\tlwb[0].y = p.x + p.y - q.x + q.y;\n";
+                if(halfLength % 2 == 0)
+                {
+                    str += "\t\t\tlwb[" + std::to_string(quarter) + "].x = 2.0 * lwb["
+                           + std::to_string(quarter) + "].x;\n";
+                    str += "\t\t\tlwb[" + std::to_string(quarter) + "].y = -2.0 * lwb["
+                           + std::to_string(quarter) + "].y;\n";
+                }
+                str += "\t\t}\n";
+                str += "\t\telse\n";
+                str += "\t\t{\n";
+                str += "\t\t\tconst T u = p + q;\n";
+                str += "\t\t\tconst T v = p - q;\n";
+                str += "\t\t\tconst T twd_p = twiddles_real[col];\n";
+                str += "\t\t\tlwb[col].x = u.x + v.x * twd_p.y - u.y * twd_p.x;\n";
+                str += "\t\t\tlwb[col].y = v.y + u.y * twd_p.y + v.x * twd_p.x;\n";
+                str += "\t\t\tlwb[idx_q].x = u.x - v.x * twd_p.y + u.y * twd_p.x;\n";
+                str += "\t\t\tlwb[idx_q].y = -v.y + u.y * twd_p.y + v.x * twd_p.x;\n";
+                str += "\t\t}\n";
+                str += "\t}\n";
+                str += "\t__syncthreads();\n\n";
+
+                str += "\t// transform each row\n";
+                str += DeviceCall(transform_row, false, length1, 1, hermLength, "twiddles");
+
+                str += "\t// write each half-length complex row out as real data\n";
+                str += RealLoopBegin(length1, halfLength);
+                str += "\t\tconst size_t oOffset = batch * _stride_out[2] + row * _stride_out[1] "
+                       "+ 2 * col * _stride_out[0];\n";
+                str += "\t\t_gbOut[oOffset] = lds_data[row * " + std::to_string(hermLength)
+                       + " + col].x;\n";
+                str += "\t\t_gbOut[oOffset + _stride_out[0]] = lds_data[row * "
+                       + std::to_string(hermLength) + " + col].y;\n";
+                str += "\t}\n";
+            }
+            str += "}\n\n";
+        }
+
+        // details of the row and column transforms
+        Kernel<rocfft_precision_single> transform_row;
+        Kernel<rocfft_precision_single> transform_col;
+    };
 };
 
 #endif
@@ -1,14 +1,23 @@
 /*******************************************************************************
  * Copyright (C) 2016 Advanced Micro Devices, Inc. All rights reserved.
  ******************************************************************************/
+#include "../../include/plan.h"
 #include "../../include/radix_table.h"
 #include "../../include/tree_node.h"
 #include "rocfft.h"
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
 #include <fstream>
+#include <functional>
+#include <iomanip>
 #include <iostream>
+#include <set>
+#include <sstream>
 #include <string.h>
 #include <string>
+#include <thread>
 #include <tuple>
 #include <vector>
 
@@ -51,20 +60,70 @@ int generate_support_size_list(std::vector<size_t>& support_size_list,
             }
         }
     }
-    // pick relatively common radix-7 sizes - radix-7 in general is
-    // not common enough to justify generating every combination
-    support_size_list.push_back(7);
-    support_size_list.push_back(28);
-    support_size_list.push_back(49);
-    support_size_list.push_back(42);
-    support_size_list.push_back(56);
-    support_size_list.push_back(84);
-    support_size_list.push_back(112);
 
     // printf("Total, there are %d valid combinations\n", counter);
     return 0;
 }
 
+/* =====================================================================
+    Add the sizes up to upper_bound that have at least one of the
+    given prime factors (7, 11 or 13), mixed with 2, 3 and 5.  Each
+    work item holds at least one butterfly of every prime radix of
+    the length, so sizes whose distinct prime factors multiply to more
+    than 2*3*5*7 are left to the library's multi-kernel plans.
+=================================================================== */
+
+void append_prime_size_list(std::vector<size_t>&       support_size_list,
+                            const std::vector<size_t>& primes,
+                            size_t                     upper_bound)
+{
+    static const size_t max_radix_product = 2 * 3 * 5 * 7;
+
+    for(size_t len = 1; len <= upper_bound; ++len)
+    {
+        size_t p             = len;
+        size_t radix_product = 1;
+        bool   has_prime     = false;
+        for(size_t radix : {2, 3, 5, 7, 11, 13})
+        {
+            bool wanted = radix <= 5 || std::count(primes.begin(), primes.end(), radix);
+            if(!wanted || p % radix != 0)
+                continue;
+            radix_product *= radix;
+            has_prime |= radix > 5;
+            while(p % radix == 0)
+                p /= radix;
+        }
+        if(p == 1 && has_prime && radix_product <= max_radix_product)
+            support_size_list.push_back(len);
+    }
+}
+
+/* =====================================================================
+    Block column kernels (SBCC and SBRC) for the kernel sizes up to
+    512 that have a block fitting in LDS
+=================================================================== */
+
+std::vector<std::tuple<size_t, ComputeScheme>>
+    generate_large1D_list(const std::vector<size_t>& support_size_list)
+{
+    std::vector<std::tuple<size_t, ComputeScheme>> retval;
+    KernelCoreSpecs                                kcs;
+    for(auto scheme : {CS_KERNEL_STOCKHAM_BLOCK_CC, CS_KERNEL_STOCKHAM_BLOCK_RC})
+    {
+        for(size_t len : support_size_list)
+        {
+            if(len > 512)
+                continue;
+            size_t wgs, nt, bwd, blockWGS, lds;
+            kcs.GetWGSAndNT(len, wgs, nt);
+            if(GetBlockComputeSizes(len, wgs / nt, bwd, blockWGS, lds))
+                retval.push_back(std::make_tuple(len, scheme));
+        }
+    }
+    return retval;
+}
+
 std::vector<std::tuple<size_t, size_t, ComputeScheme>>
     generate_support_size_list_2D(rocfft_precision precision)
 {
@@ -77,9 +136,159 @@ std::vector<std::tuple<size_t, size_t, ComputeScheme>>
     {
         retval.push_back(std::make_tuple(s.first, s.second, CS_KERNEL_2D_SINGLE));
     }
+    for(const auto& s : Single2DRealSizes(0, precision, GetWGSAndNT))
+    {
+        retval.push_back(std::make_tuple(s.first, s.second, CS_KERNEL_2D_SINGLE_REAL));
+    }
     return retval;
 }
 
+/* =====================================================================
+    Restrict the generated sizes to those listed in a manifest file.
+    Each line of the manifest names one kernel:
+
+      1d <length>                  single-kernel 1D transform
+      sbcc <length>                large 1D column-to-column kernel
+      sbrc <length>                large 1D row-to-column kernel
+      2d <length0> <length1>       fused 2D transform
+      2d_real <length0> <length1>  fused 2D real transform
+
+    Blank lines and lines starting with '#' are ignored.  Power-of-2
+    1D kernels are always generated, since the library decomposes
+    lengths that have no kernel into them.
+=================================================================== */
+
+int apply_size_manifest(const std::string&                                      fileName,
+                        std::vector<size_t>&                                    support_list,
+                        std::vector<std::tuple<size_t, ComputeScheme>>&         large1D_list,
+                        std::vector<std::tuple<size_t, size_t, ComputeScheme>>& list_2D_single,
+                        std::vector<std::tuple<size_t, size_t, ComputeScheme>>& list_2D_double)
+{
+    std::ifstream manifest(fileName);
+    if(!manifest.is_open())
+    {
+        std::cerr << "Could not open kernel manifest " << fileName << std::endl;
+        return -1;
+    }
+
+    std::set<size_t>                                    lengths;
+    std::set<std::tuple<size_t, ComputeScheme>>         large1D;
+    std::set<std::tuple<size_t, size_t, ComputeScheme>> sizes_2D;
+
+    std::string line;
+    for(size_t line_num = 1; std::getline(manifest, line); ++line_num)
+    {
+        std::istringstream fields(line);
+        std::string        kind;
+        size_t             len0 = 0, len1 = 0;
+        if(!(fields >> kind) || kind[0] == '#')
+            continue;
+
+        bool valid = false;
+        if(kind == "1d" && fields >> len0)
+        {
+            valid = std::find(support_list.begin(), support_list.end(), len0)
+                    != support_list.end();
+            lengths.insert(len0);
+        }
+        else if((kind == "sbcc" || kind == "sbrc") && fields >> len0)
+        {
+            auto key = std::make_tuple(
+                len0, kind == "sbcc" ? CS_KERNEL_STOCKHAM_BLOCK_CC : CS_KERNEL_STOCKHAM_BLOCK_RC);
+            valid = std::find(large1D_list.begin(), large1D_list.end(), key) != large1D_list.end();
+            large1D.insert(key);
+        }
+        else if((kind == "2d" || kind == "2d_real") && fields >> len0 >> len1)
+        {
+            auto key = std::make_tuple(
+                len0, len1, kind == "2d" ? CS_KERNEL_2D_SINGLE : CS_KERNEL_2D_SINGLE_REAL);
+            valid = std::find(list_2D_single.begin(), list_2D_single.end(), key)
+                    != list_2D_single.end();
+            sizes_2D.insert(key);
+        }
+
+        if(!valid)
+        {
+            std::cerr << fileName << ":" << line_num << ": no kernel can be generated for \""
+                      << line << "\"" << std::endl;
+            return -1;
+        }
+    }
+
+    // filter the full lists, so kernels keep the order they'd have
+    // in a full build
+    auto erase_if = [](auto& list, auto pred) {
+        list.erase(std::remove_if(list.begin(), list.end(), pred), list.end());
+    };
+    erase_if(support_list, [&lengths](size_t len) { return !IsPo2(len) && !lengths.count(len); });
+    erase_if(large1D_list, [&large1D](const auto& key) { return !large1D.count(key); });
+    erase_if(list_2D_single, [&sizes_2D](const auto& key) { return !sizes_2D.count(key); });
+    erase_if(list_2D_double, [&sizes_2D](const auto& key) { return !sizes_2D.count(key); });
+    return 0;
+}
+
+/* =====================================================================
+    Kernel headers are independent of each other, so they are generated
+    on a pool of threads.  Each job writes its own file, so the output
+    does not depend on the order jobs finish in.
+
+    ROCFFT_GENERATOR_THREADS sets the number of threads (default: one
+    per hardware thread), and ROCFFT_GENERATOR_TIMING=1 prints how long
+    each job took, in job order.
+=================================================================== */
+
+struct GeneratorJob
+{
+    std::string           name;
+    std::function<void()> generate;
+    double                ms = 0.0;
+};
+
+static unsigned int generator_threads()
+{
+    const char* env = getenv("ROCFFT_GENERATOR_THREADS");
+    if(env != nullptr && atoi(env) > 0)
+        return atoi(env);
+    return std::max(std::thread::hardware_concurrency(), 1u);
+}
+
+static void run_generator_jobs(std::vector<GeneratorJob>& jobs)
+{
+    using clock = std::chrono::steady_clock;
+
+    const auto          start = clock::now();
+    std::atomic<size_t> next_job(0);
+
+    auto worker = [&jobs, &next_job]() {
+        for(size_t i = next_job++; i < jobs.size(); i = next_job++)
+        {
+            const auto job_start = clock::now();
+            jobs[i].generate();
+            jobs[i].ms
+                = std::chrono::duration<double, std::milli>(clock::now() - job_start).count();
+        }
+    };
+
+    const unsigned int       num_threads = std::min<size_t>(generator_threads(), jobs.size());
+    std::vector<std::thread> threads;
+    for(unsigned int t = 1; t < num_threads; ++t)
+        threads.emplace_back(worker);
+    worker();
+    for(auto& t : threads)
+        t.join();
+
+    const char* timing = getenv("ROCFFT_GENERATOR_TIMING");
+    if(timing != nullptr && atoi(timing) != 0)
+    {
+        for(const auto& job : jobs)
+            std::cout << std::setw(24) << std::left << job.name << std::fixed
+                      << std::setprecision(2) << job.ms << " ms" << std::endl;
+        std::cout << jobs.size() << " kernels generated by " << num_threads << " threads in "
+                  << std::chrono::duration<double, std::milli>(clock::now() - start).count()
+                  << " ms" << std::endl;
+    }
+}
+
 int main(int argc, char* argv[])
 {
 
@@ -100,6 +309,7 @@ int main(int argc, char* argv[])
   */
 
     std::vector<size_t> support_size_list;
+    std::string         size_manifest;
 
     int small_kernels_group_num = 8; // default
 
@@ -140,16 +350,33 @@ int main(int argc, char* argv[])
         }
         else if(strcmp(argv[1], "all") == 0)
         {
-            // printf("Generating len mix of 2,3,5 FFT kernels\n");
+            // printf("Generating len mix of 2,3,5,7 FFT kernels\n");
             generate_support_size_list(
                 support_size_list, 3125, 2187, Large1DThreshold(rocfft_precision_single));
+            append_prime_size_list(
+                support_size_list, {7}, Large1DThreshold(rocfft_precision_single));
+        }
+        else if(strcmp(argv[1], "manifest") == 0)
+        {
+            // start from all sizes, and keep those in the manifest
+            if(argc < 4)
+            {
+                std::cerr << "manifest requires a kernel manifest file name" << std::endl;
+                return 1;
+            }
+            size_manifest = argv[3];
+            generate_support_size_list(
+                support_size_list, 3125, 2187, Large1DThreshold(rocfft_precision_single));
+            append_prime_size_list(
+                support_size_list, {7, 11, 13}, Large1DThreshold(rocfft_precision_single));
         }
     }
     else
     { // if no arguments, generate all possible sizes
-        // printf("Generating len mix of 2,3,5 FFT kernels\n");
+        // printf("Generating len mix of 2,3,5,7 FFT kernels\n");
         generate_support_size_list(
             support_size_list, 3125, 2187, Large1DThreshold(rocfft_precision_single));
+        append_prime_size_list(support_size_list, {7}, Large1DThreshold(rocfft_precision_single));
     }
 
     if(argc > 2)
@@ -167,6 +394,25 @@ int main(int argc, char* argv[])
     auto support_size_list_2D_single = generate_support_size_list_2D(rocfft_precision_single);
     auto support_size_list_2D_double = generate_support_size_list_2D(rocfft_precision_double);
 
+    /* =====================================================================
+
+    large1D is not a single kernels but a bunch of small kernels combinations
+    here we use a vector of tuple to store the supported sizes
+    Large 1D and 2D transforms are broken into the block column
+    kernels of these sizes
+  =================================================================== */
+
+    auto large1D_list = generate_large1D_list(support_size_list);
+
+    if(!size_manifest.empty()
+       && apply_size_manifest(size_manifest,
+                              support_size_list,
+                              large1D_list,
+                              support_size_list_2D_single,
+                              support_size_list_2D_double)
+              != 0)
+        return 1;
+
     /*
       for(size_t i=7;i<=2401;i*=7){
           printf("Generating len %d FFT kernels\n", (int)i);
@@ -179,10 +425,12 @@ int main(int argc, char* argv[])
      generate small kernel into *.h file
   =================================================================== */
 
+    std::vector<GeneratorJob> jobs;
     for(size_t i = 0; i < support_size_list.size(); i++)
     {
-        // printf("Generating len %d FFT kernels\n", support_size_list[i]);
-        generate_kernel(support_size_list[i], CS_KERNEL_STOCKHAM);
+        const size_t len = support_size_list[i];
+        jobs.push_back(
+            {std::to_string(len), [len]() { generate_kernel(len, CS_KERNEL_STOCKHAM); }});
     }
 
     // printf("Wrtie small size CPU functions implemention to *.cpp files \n");
@@ -190,30 +438,13 @@ int main(int argc, char* argv[])
     write_cpu_function_small(support_size_list, "single", small_kernels_group_num);
     write_cpu_function_small(support_size_list, "double", small_kernels_group_num);
 
-    /* =====================================================================
-
-    large1D is not a single kernels but a bunch of small kernels combinations
-    here we use a vector of tuple to store the supported sizes
-    Initially available is 8K - 64K break into 64, 128, 256 combinations
-  =================================================================== */
-
-    std::vector<std::tuple<size_t, ComputeScheme>> large1D_list;
-    large1D_list.push_back(std::make_tuple(64, CS_KERNEL_STOCKHAM_BLOCK_CC));
-    large1D_list.push_back(std::make_tuple(81, CS_KERNEL_STOCKHAM_BLOCK_CC));
-    large1D_list.push_back(std::make_tuple(100, CS_KERNEL_STOCKHAM_BLOCK_CC));
-    large1D_list.push_back(std::make_tuple(128, CS_KERNEL_STOCKHAM_BLOCK_CC));
-    large1D_list.push_back(std::make_tuple(256, CS_KERNEL_STOCKHAM_BLOCK_CC));
-
-    large1D_list.push_back(std::make_tuple(64, CS_KERNEL_STOCKHAM_BLOCK_RC));
-    large1D_list.push_back(std::make_tuple(81, CS_KERNEL_STOCKHAM_BLOCK_RC));
-    large1D_list.push_back(std::make_tuple(100, CS_KERNEL_STOCKHAM_BLOCK_RC));
-    large1D_list.push_back(std::make_tuple(128, CS_KERNEL_STOCKHAM_BLOCK_RC));
-    large1D_list.push_back(std::make_tuple(256, CS_KERNEL_STOCKHAM_BLOCK_RC));
-
     for(int i = 0; i < large1D_list.size(); i++)
     {
         auto my_tuple = large1D_list[i];
-        generate_kernel(std::get<0>(my_tuple), std::get<1>(my_tuple));
+        auto suffix   = std::get<1>(my_tuple) == CS_KERNEL_STOCKHAM_BLOCK_CC ? "_sbcc" : "_sbrc";
+        jobs.push_back({std::to_string(std::get<0>(my_tuple)) + suffix, [my_tuple]() {
+                            generate_kernel(std::get<0>(my_tuple), std::get<1>(my_tuple));
+                        }});
     }
 
     // write big size CPU functions; one file for one size
@@ -226,7 +457,14 @@ int main(int argc, char* argv[])
     // generated code is all templated so we can generate the largest
     // number of sizes and decide at runtime whether the
     // double-precision variants can be used based on available LDS
-    generate_2D_kernels(support_size_list_2D_single);
+    for(const auto& dim : support_size_list_2D_single)
+    {
+        auto name = (std::get<2>(dim) == CS_KERNEL_2D_SINGLE_REAL ? "2D_real_" : "2D_")
+                    + std::to_string(std::get<0>(dim)) + "_" + std::to_string(std::get<1>(dim));
+        jobs.push_back({name, [dim]() { generate_2D_kernel(dim); }});
+    }
+
+    run_generator_jobs(jobs);
 
     // printf("Write CPU functions declaration to *.h file \n");
     WriteCPUHeaders(support_size_list, large1D_list, support_size_list_2D_single);
@@ -234,4 +472,9 @@ int main(int argc, char* argv[])
     // printf("Add CPU function into hash map \n");
     AddCPUFunctionToPool(
         support_size_list, large1D_list, support_size_list_2D_single, support_size_list_2D_double);
+
+    // host versions of the small kernels, for testing without a GPU
+    WriteHostKernels(support_size_list);
+
+    WriteGeneratedManifest("rocfft_generated_kernels.manifest");
 }
@@ -51,7 +51,9 @@ namespace StockhamGenerator
         bool      halfLds; // only half the LDS of a complex length need to be used
         Pass<PR>* nextPass = nullptr;
 
-        bool fft_doPreCallback  = false; // two call back variable
+        // read the kernel input / write the kernel output through the
+        // user callbacks, for the first / last pass
+        bool fft_doPreCallback  = false;
         bool fft_doPostCallback = false;
 
         inline void RegBase(size_t regC, std::string& str) const
@@ -426,6 +428,12 @@ namespace StockhamGenerator
                             passStr += regIndex;
                             passStr += " = ";
 
+                            if(fft_doPreCallback && interleaved && (component == SR_COMP_BOTH))
+                            {
+                                passStr += "load_cb(cb, " + buffer + ", " + bufOffset + ");";
+                                break;
+                            }
+
                             passStr += buffer;
                             passStr += "[";
                             passStr += bufOffset;
@@ -539,6 +547,13 @@ namespace StockhamGenerator
                             if(c == cStart)
                                 regIndexC0 = regIndex;
 
+                            if(fft_doPostCallback && interleaved && (component == SR_COMP_BOTH))
+                            {
+                                passStr += "\n\tstore_cb(cb, " + buffer + ", " + bufOffset + ", "
+                                           + regIndex + ");";
+                                break;
+                            }
+
                             passStr += "\n\t";
                             passStr += buffer;
                             passStr += "[";
@@ -1690,12 +1705,12 @@ namespace StockhamGenerator
             enableGrouping = grp;
         }
 
-        void SetPrecallback(bool hasPrecallback) // not used even
+        void SetPrecallback(bool hasPrecallback)
         {
             fft_doPreCallback = hasPrecallback;
         }
 
-        void SetPostcallback(bool hasPostcallback) // not used even
+        void SetPostcallback(bool hasPostcallback)
         {
             fft_doPostCallback = hasPostcallback;
         }
@@ -1771,6 +1786,8 @@ namespace StockhamGenerator
             if(realSpecial)
                 passStr += "unsigned int t, ";
             passStr += "unsigned int me, unsigned int inOffset, unsigned int outOffset, ";
+            if(fft_doPreCallback || fft_doPostCallback)
+                passStr += "const UserCallbacks& cb, ";
 
             if(r2c || c2r)
             {
@@ -3221,6 +3238,75 @@ namespace StockhamGenerator
 
             passStr += "\n}\n\n";
         }
+
+        // Host code for this pass of one transform: a loop over all of
+        // its butterflies, with the same reads, twiddle multiplies and
+        // writes as the device pass, but without work-items or LDS.
+        // bufIn and bufOut are indexed with inStride and outStride.
+        void GenerateHostPass(bool               fwd,
+                              const std::string& bufIn,
+                              const std::string& inStride,
+                              const std::string& bufOut,
+                              const std::string& outStride,
+                              std::string&       passStr) const
+        {
+            const size_t numBflyTotal = length / radix;
+
+            passStr += "\n\t\t// pass " + std::to_string(position) + ", radix "
+                       + std::to_string(radix) + "\n";
+            passStr += "\t\tfor(size_t b = 0; b < " + std::to_string(numBflyTotal) + "; ++b)\n";
+            passStr += "\t\t{\n";
+
+            for(size_t r = 0; r < radix; r++)
+            {
+                passStr += "\t\t\tT R" + std::to_string(r) + " = " + bufIn + "[(b + "
+                           + std::to_string(r * numBflyTotal) + ")" + inStride + "];\n";
+            }
+
+            // twiddle index and multiply match SweepRegs(SR_TWMUL)
+            if(algLS > 1)
+            {
+                for(size_t r = 1; r < radix; r++)
+                {
+                    const std::string reg = "R" + std::to_string(r);
+                    passStr += "\t\t\t{\n";
+                    passStr += "\t\t\t\tconst T W = twiddles[" + std::to_string(algLS - 1) + " + "
+                               + std::to_string(radix - 1) + " * (b % " + std::to_string(algLS)
+                               + ") + " + std::to_string(r - 1) + "];\n";
+                    if(fwd)
+                    {
+                        passStr += "\t\t\t\t" + reg + " = lib_make_vector2<T>(W.x * " + reg
+                                   + ".x - W.y * " + reg + ".y, W.y * " + reg + ".x + W.x * "
+                                   + reg + ".y);\n";
+                    }
+                    else
+                    {
+                        passStr += "\t\t\t\t" + reg + " = lib_make_vector2<T>(W.x * " + reg
+                                   + ".x + W.y * " + reg + ".y, -W.y * " + reg + ".x + W.x * "
+                                   + reg + ".y);\n";
+                    }
+                    passStr += "\t\t\t}\n";
+                }
+            }
+
+            if(radix > 1)
+            {
+                passStr += "\t\t\t" + ButterflyName(radix, 1, fwd) + "(";
+                for(size_t r = 0; r < radix; r++)
+                    passStr += (r ? ", &R" : "&R") + std::to_string(r);
+                passStr += ");\n";
+            }
+
+            for(size_t r = 0; r < radix; r++)
+            {
+                passStr += "\t\t\t" + bufOut + "[((b / " + std::to_string(algLS) + ") * "
+                           + std::to_string(algL) + " + b % " + std::to_string(algLS) + " + "
+                           + std::to_string(r * algLS) + ")" + outStride + "] = R"
+                           + std::to_string(r) + ";\n";
+            }
+
+            passStr += "\t\t}\n";
+        }
     };
 };
 
@@ -0,0 +1,58 @@
+/*******************************************************************************
+ * Copyright (C) 2020 Advanced Micro Devices, Inc. All rights reserved.
+ ******************************************************************************/
+
+#pragma once
+
+#ifndef ROCFFT_HOST_KERNEL_TEMPLATE_H
+#define ROCFFT_HOST_KERNEL_TEMPLATE_H
+
+#include <cmath>
+#include <hip/hip_runtime.h>
+#include <vector>
+
+#include "rocfft_butterfly_template.h"
+
+// Host version of a generated Stockham kernel, doing a batch of
+// complex transforms:
+//   f(twiddles, batch, in, stride_in, dist_in, out, stride_out, dist_out)
+// Input and output may be the same buffer.
+template <typename T>
+using HostKernelFunction
+    = void (*)(const T*, size_t, const T*, size_t, size_t, T*, size_t, size_t);
+
+template <typename T>
+struct HostKernel
+{
+    size_t                length;
+    std::vector<size_t>   radices; // radix of each pass
+    HostKernelFunction<T> fwd;
+    HostKernelFunction<T> back;
+};
+
+// Twiddle table for a kernel with the given radices, in the same
+// layout as TwiddleTable::GenerateTwiddleTable builds for the device
+// kernel.
+template <typename T>
+std::vector<T> host_kernel_twiddles(const std::vector<size_t>& radices)
+{
+    const double TWO_PI = -6.283185307179586476925286766559;
+
+    std::vector<T> wc;
+    size_t         L = 1;
+    for(size_t radix : radices)
+    {
+        L *= radix;
+        for(size_t k = 0; k < (L / radix); k++)
+        {
+            double theta = TWO_PI * (k) / (L);
+            for(size_t j = 1; j < radix; j++)
+                wc.push_back(lib_make_vector2<T>(cos((j)*theta), sin((j)*theta)));
+        }
+    }
+    // the table is allocated with one entry per point
+    wc.resize(L);
+    return wc;
+}
+
+#endif // ROCFFT_HOST_KERNEL_TEMPLATE_H
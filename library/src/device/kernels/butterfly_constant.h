@@ -31,6 +31,14 @@
 // butterfly radix-8 constants
 #define C8Q 0.70710678118654752440084436210485
 
+// butterfly radix-9 constants: cos and sin of 2pi/9, 4pi/9 and 8pi/9
+#define C9QA 0.76604444311897803520239265055542
+#define C9QB 0.64278760968653932632264340990726
+#define C9QC 0.17364817766693034885171662676931
+#define C9QD 0.98480775301220805936674302458952
+#define C9QE -0.93969262078590838405410927732473
+#define C9QF 0.34202014332566873304409961468226
+
 // butterfly radix-11 constants
 #define b11_0 0.9898214418809327
 #define b11_1 0.9594929736144973
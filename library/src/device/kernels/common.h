@@ -5,6 +5,7 @@
 #ifndef COMMON_H
 #define COMMON_H
 #include "rocfft.h"
+#include "user_callbacks.h"
 #include <hip/hip_vector_types.h>
 #include <iostream>
 
@@ -146,10 +147,10 @@ using vector2_type_t = typename vector2_type<T>::type;
 // vector2_type_t<rocfft_precision_double> double2_scalar;
 
 template <typename T>
-__device__ inline T lib_make_vector2(real_type_t<T> v0, real_type_t<T> v1);
+__host__ __device__ inline T lib_make_vector2(real_type_t<T> v0, real_type_t<T> v1);
 
 template <>
-__device__ inline float2 lib_make_vector2(float v0, float v1)
+__host__ __device__ inline float2 lib_make_vector2(float v0, float v1)
 #ifdef __NVCC__
 {
     return make_float2(v0, v1);
@@ -161,7 +162,7 @@ __device__ inline float2 lib_make_vector2(float v0, float v1)
 #endif
 
 template <>
-__device__ inline double2 lib_make_vector2(double v0, double v1)
+__host__ __device__ inline double2 lib_make_vector2(double v0, double v1)
 #ifdef __NVCC__
 {
     return make_double2(v0, v1);
@@ -276,4 +277,36 @@ __device__ T TWLstep4(T* twiddles, size_t u)
         REG.y = TI;                                        \
     }
 
+// User callbacks, see rocfft_plan_set_load_callback and
+// rocfft_plan_set_store_callback
+template <typename T>
+using UserLoadCallback = T (*)(T* buffer, size_t offset, void* cb_data);
+template <typename T>
+using UserStoreCallback = void (*)(T* buffer, size_t offset, T element, void* cb_data);
+
+// Read element 'offset' of a kernel's input through the load callback
+template <typename T>
+__device__ inline T load_cb(const UserCallbacks& cb, T* buffer, size_t offset)
+{
+    if(cb.load_fn == nullptr)
+        return buffer[offset];
+    T* base = static_cast<T*>(cb.in_base);
+    return reinterpret_cast<UserLoadCallback<T>>(cb.load_fn)(
+        base, buffer - base + offset, cb.load_data);
+}
+
+// Write element 'offset' of a kernel's output through the store callback
+template <typename T>
+__device__ inline void store_cb(const UserCallbacks& cb, T* buffer, size_t offset, T element)
+{
+    if(cb.store_fn == nullptr)
+    {
+        buffer[offset] = element;
+        return;
+    }
+    T* base = static_cast<T*>(cb.out_base);
+    reinterpret_cast<UserStoreCallback<T>>(cb.store_fn)(
+        base, buffer - base + offset, element, cb.store_data);
+}
+
 #endif // COMMON_H
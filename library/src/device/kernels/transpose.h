@@ -179,6 +179,28 @@ __device__ void transpose_tile_device(const T_I*   input,
     }
 }
 
+// - add the offsets of the dimensions above the transposed ones,
+//   which are folded together with the batch into hipBlockIdx_z
+// - lengths is zero after the last dimension, where the strides
+//   hold the distance between batches
+__device__ inline void transpose_higher_dim_offsets(size_t        counter_mod,
+                                                    size_t        dim,
+                                                    const size_t* lengths,
+                                                    const size_t* stride_in,
+                                                    const size_t* stride_out,
+                                                    size_t&       iOffset,
+                                                    size_t&       oOffset)
+{
+    for(; lengths[dim] != 0; dim++)
+    {
+        iOffset += (counter_mod % lengths[dim]) * stride_in[dim];
+        oOffset += (counter_mod % lengths[dim]) * stride_out[dim];
+        counter_mod /= lengths[dim];
+    }
+    iOffset += counter_mod * stride_in[dim];
+    oOffset += counter_mod * stride_out[dim];
+}
+
 // - transpose input of size m * n to output of size n * m
 //   input, output are in device memory
 // - 2D grid and 2D thread block (DIM_X, DIM_Y)
@@ -207,10 +229,8 @@ __global__ void transpose_kernel2(const T_I* input,
     size_t iOffset = 0;
     size_t oOffset = 0;
 
-    size_t counter_mod = hipBlockIdx_z;
-
-    iOffset += counter_mod * stride_in[2];
-    oOffset += counter_mod * stride_out[2];
+    transpose_higher_dim_offsets(
+        hipBlockIdx_z, 2, lengths, stride_in, stride_out, iOffset, oOffset);
 
     size_t tileBlockIdx_x, tileBlockIdx_y;
     if(DIAGONAL) // diagonal reordering
@@ -396,10 +416,8 @@ __global__ void transpose_kernel2_scheme(const T_I* input,
     size_t iOffset = 0;
     size_t oOffset = 0;
 
-    size_t counter_mod = hipBlockIdx_z;
-
-    iOffset += counter_mod * stride_in[3];
-    oOffset += counter_mod * stride_out[3];
+    transpose_higher_dim_offsets(
+        hipBlockIdx_z, 3, lengths, stride_in, stride_out, iOffset, oOffset);
 
     size_t tileBlockIdx_x, tileBlockIdx_y;
     if(DIAGONAL) // diagonal reordering
@@ -37,37 +37,39 @@ __device__ inline void post_process_interleaved(const size_t    idx_p,
                                                 const size_t    half_N,
                                                 const size_t    quarter_N,
                                                 const Tcomplex* input,
+                                                const size_t    input_stride,
                                                 Tcomplex*       output,
+                                                const size_t    output_stride,
                                                 const Tcomplex* twiddles)
 {
     if(idx_p == 0)
     {
-        output[half_N].x = input[0].x - input[0].y;
-        output[half_N].y = 0;
-        output[0].x      = input[0].x + input[0].y;
-        output[0].y      = 0;
+        output[half_N * output_stride].x = input[0].x - input[0].y;
+        output[half_N * output_stride].y = 0;
+        output[0].x                      = input[0].x + input[0].y;
+        output[0].y                      = 0;
 
         if(Ndiv4)
         {
-            output[quarter_N].x = input[quarter_N].x;
-            output[quarter_N].y = -input[quarter_N].y;
+            output[quarter_N * output_stride].x = input[quarter_N * input_stride].x;
+            output[quarter_N * output_stride].y = -input[quarter_N * input_stride].y;
         }
     }
     else
     {
-        const Tcomplex p = input[idx_p];
-        const Tcomplex q = input[idx_q];
+        const Tcomplex p = input[idx_p * input_stride];
+        const Tcomplex q = input[idx_q * input_stride];
         const Tcomplex u = 0.5 * (p + q);
         const Tcomplex v = 0.5 * (p - q);
 
         const Tcomplex twd_p = twiddles[idx_p];
         // NB: twd_q = -conj(twd_p) = (-twd_p.x, twd_p.y);
 
-        output[idx_p].x = u.x + v.x * twd_p.y + u.y * twd_p.x;
-        output[idx_p].y = v.y + u.y * twd_p.y - v.x * twd_p.x;
+        output[idx_p * output_stride].x = u.x + v.x * twd_p.y + u.y * twd_p.x;
+        output[idx_p * output_stride].y = v.y + u.y * twd_p.y - v.x * twd_p.x;
 
-        output[idx_q].x = u.x - v.x * twd_p.y - u.y * twd_p.x;
-        output[idx_q].y = -v.y + u.y * twd_p.y - v.x * twd_p.x;
+        output[idx_q * output_stride].x = u.x - v.x * twd_p.y - u.y * twd_p.x;
+        output[idx_q * output_stride].y = -v.y + u.y * twd_p.y - v.x * twd_p.x;
     }
 }
 
@@ -78,8 +80,10 @@ __device__ inline void post_process_interleaved(const size_t    idx_p,
 template <typename Tcomplex, bool Ndiv4>
 __global__ static void real_post_process_kernel_interleaved_1D(const size_t half_N,
                                                                const void*  input0,
+                                                               const size_t input_stride,
                                                                const size_t idist,
                                                                void*        output0,
+                                                               const size_t output_stride,
                                                                const size_t odist,
                                                                const void*  twiddles0)
 {
@@ -101,7 +105,7 @@ __global__ static void real_post_process_kernel_interleaved_1D(const size_t half
         // clang format on
 
         post_process_interleaved<Tcomplex, Ndiv4>(
-            idx_p, idx_q, half_N, quarter_N, input, output, twiddles);
+            idx_p, idx_q, half_N, quarter_N, input, input_stride, output, output_stride, twiddles);
     }
 }
 
@@ -111,8 +115,10 @@ __global__ static void real_post_process_kernel_interleaved(const size_t half_N,
                                                             const size_t idist1D,
                                                             const size_t odist1D,
                                                             const void*  input0,
+                                                            const size_t input_stride,
                                                             const size_t idist,
                                                             void*        output0,
+                                                            const size_t output_stride,
                                                             const size_t odist,
                                                             const void*  twiddles0)
 {
@@ -135,7 +141,7 @@ __global__ static void real_post_process_kernel_interleaved(const size_t half_N,
         // clang format on
 
         post_process_interleaved<Tcomplex, Ndiv4>(
-            idx_p, idx_q, half_N, quarter_N, input, output, twiddles);
+            idx_p, idx_q, half_N, quarter_N, input, input_stride, output, output_stride, twiddles);
     }
 }
 
@@ -145,38 +151,40 @@ __device__ inline void post_process_planar(const size_t           idx_p,
                                            const size_t           half_N,
                                            const size_t           quarter_N,
                                            const Tcomplex*        input,
+                                           const size_t           input_stride,
                                            real_type_t<Tcomplex>* outputRe,
                                            real_type_t<Tcomplex>* outputIm,
+                                           const size_t           output_stride,
                                            const Tcomplex*        twiddles)
 {
     if(idx_p == 0)
     {
-        outputRe[half_N] = input[0].x - input[0].y;
-        outputIm[half_N] = 0;
-        outputRe[0]      = input[0].x + input[0].y;
-        outputIm[0]      = 0;
+        outputRe[half_N * output_stride] = input[0].x - input[0].y;
+        outputIm[half_N * output_stride] = 0;
+        outputRe[0]                      = input[0].x + input[0].y;
+        outputIm[0]                      = 0;
 
         if(Ndiv4)
         {
-            outputRe[quarter_N] = input[quarter_N].x;
-            outputIm[quarter_N] = -input[quarter_N].y;
+            outputRe[quarter_N * output_stride] = input[quarter_N * input_stride].x;
+            outputIm[quarter_N * output_stride] = -input[quarter_N * input_stride].y;
         }
     }
     else
     {
-        const Tcomplex p = input[idx_p];
-        const Tcomplex q = input[idx_q];
+        const Tcomplex p = input[idx_p * input_stride];
+        const Tcomplex q = input[idx_q * input_stride];
         const Tcomplex u = 0.5 * (p + q);
         const Tcomplex v = 0.5 * (p - q);
 
         const Tcomplex twd_p = twiddles[idx_p];
         // NB: twd_q = -conj(twd_p) = (-twd_p.x, twd_p.y);
 
-        outputRe[idx_p] = u.x + v.x * twd_p.y + u.y * twd_p.x;
-        outputIm[idx_p] = v.y + u.y * twd_p.y - v.x * twd_p.x;
+        outputRe[idx_p * output_stride] = u.x + v.x * twd_p.y + u.y * twd_p.x;
+        outputIm[idx_p * output_stride] = v.y + u.y * twd_p.y - v.x * twd_p.x;
 
-        outputRe[idx_q] = u.x - v.x * twd_p.y - u.y * twd_p.x;
-        outputIm[idx_q] = -v.y + u.y * twd_p.y - v.x * twd_p.x;
+        outputRe[idx_q * output_stride] = u.x - v.x * twd_p.y - u.y * twd_p.x;
+        outputIm[idx_q * output_stride] = -v.y + u.y * twd_p.y - v.x * twd_p.x;
     }
 }
 
@@ -184,9 +192,11 @@ __device__ inline void post_process_planar(const size_t           idx_p,
 template <typename Tcomplex, bool Ndiv4>
 __global__ static void real_post_process_kernel_planar_1D(const size_t half_N,
                                                           const void*  input0,
+                                                          const size_t input_stride,
                                                           const size_t idist,
                                                           void*        output0,
                                                           void*        output1,
+                                                          const size_t output_stride,
                                                           const size_t odist,
                                                           const void*  twiddles0)
 {
@@ -209,8 +219,16 @@ __global__ static void real_post_process_kernel_planar_1D(const size_t half_N,
         auto       outputIm = (real_type_t<Tcomplex>*)(output1) + blockIdx.z * odist;
         // clang format on
 
-        post_process_planar<Tcomplex, Ndiv4>(
-            idx_p, idx_q, half_N, quarter_N, input, outputRe, outputIm, twiddles);
+        post_process_planar<Tcomplex, Ndiv4>(idx_p,
+                                             idx_q,
+                                             half_N,
+                                             quarter_N,
+                                             input,
+                                             input_stride,
+                                             outputRe,
+                                             outputIm,
+                                             output_stride,
+                                             twiddles);
     }
 }
 
@@ -220,9 +238,11 @@ __global__ static void real_post_process_kernel_planar(const size_t half_N,
                                                        const size_t idist1D,
                                                        const size_t odist1D,
                                                        const void*  input0,
+                                                       const size_t input_stride,
                                                        const size_t idist,
                                                        void*        output0,
                                                        void*        output1,
+                                                       const size_t output_stride,
                                                        const size_t odist,
                                                        const void*  twiddles0)
 {
@@ -247,8 +267,16 @@ __global__ static void real_post_process_kernel_planar(const size_t half_N,
             = (real_type_t<Tcomplex>*)(output1) + blockIdx.y * odist1D + blockIdx.z * odist;
         // clang format on
 
-        post_process_planar<Tcomplex, Ndiv4>(
-            idx_p, idx_q, half_N, quarter_N, input, outputRe, outputIm, twiddles);
+        post_process_planar<Tcomplex, Ndiv4>(idx_p,
+                                             idx_q,
+                                             half_N,
+                                             quarter_N,
+                                             input,
+                                             input_stride,
+                                             outputRe,
+                                             outputIm,
+                                             output_stride,
+                                             twiddles);
     }
 }
 
@@ -313,8 +341,10 @@ void r2c_1d_post(const void* data_p, void*)
     // The upper level provides always N/2, that is regular complex fft size
     const size_t half_N = data->node->length[0];
 
-    const size_t idist = data->node->iDist;
-    const size_t odist = data->node->oDist;
+    const size_t input_stride  = data->node->inStride[0];
+    const size_t output_stride = data->node->outStride[0];
+    const size_t idist         = data->node->iDist;
+    const size_t odist         = data->node->oDist;
 
     const void* bufIn0  = data->bufIn[0];
     void*       bufOut0 = data->bufOut[0];
@@ -350,8 +380,10 @@ void r2c_1d_post(const void* data_p, void*)
                                    data->rocfft_stream,
                                    half_N,
                                    bufIn0,
+                                   input_stride,
                                    idist,
                                    bufOut0,
+                                   output_stride,
                                    odist,
                                    data->node->twiddles.data());
             }
@@ -364,9 +396,11 @@ void r2c_1d_post(const void* data_p, void*)
                                    data->rocfft_stream,
                                    half_N,
                                    bufIn0,
+                                   input_stride,
                                    idist,
                                    bufOut0,
                                    bufOut1,
+                                   output_stride,
                                    odist,
                                    data->node->twiddles.data());
             }
@@ -386,8 +420,10 @@ void r2c_1d_post(const void* data_p, void*)
                                    idist1D,
                                    odist1D,
                                    bufIn0,
+                                   input_stride,
                                    idist,
                                    bufOut0,
+                                   output_stride,
                                    odist,
                                    data->node->twiddles.data());
             }
@@ -402,9 +438,11 @@ void r2c_1d_post(const void* data_p, void*)
                                    idist1D,
                                    odist1D,
                                    bufIn0,
+                                   input_stride,
                                    idist,
                                    bufOut0,
                                    bufOut1,
+                                   output_stride,
                                    odist,
                                    data->node->twiddles.data());
             }
@@ -425,8 +463,10 @@ __global__ static void real_pre_process_kernel(const size_t half_N,
                                                const size_t idist1D,
                                                const size_t odist1D,
                                                const void*  input0,
+                                               const size_t input_stride,
                                                const size_t idist,
                                                void*        output0,
+                                               const size_t output_stride,
                                                const size_t odist,
                                                const void*  twiddles0)
 {
@@ -450,21 +490,21 @@ __global__ static void real_pre_process_kernel(const size_t half_N,
             // NB: multi-dimensional transforms may have non-zero
             // imaginary part at index 0 or at the Nyquist frequency.
 
-            const Tcomplex p = input[idx_p];
-            const Tcomplex q = input[idx_q];
-            output[idx_p].x  = p.x - p.y + q.x + q.y;
-            output[idx_p].y  = p.x + p.y - q.x + q.y;
+            const Tcomplex p                = input[idx_p * input_stride];
+            const Tcomplex q                = input[idx_q * input_stride];
+            output[idx_p * output_stride].x = p.x - p.y + q.x + q.y;
+            output[idx_p * output_stride].y = p.x + p.y - q.x + q.y;
 
             if(Ndiv4)
             {
-                output[quarter_N].x = 2.0 * input[quarter_N].x;
-                output[quarter_N].y = -2.0 * input[quarter_N].y;
+                output[quarter_N * output_stride].x = 2.0 * input[quarter_N * input_stride].x;
+                output[quarter_N * output_stride].y = -2.0 * input[quarter_N * input_stride].y;
             }
         }
         else
         {
-            const Tcomplex p = input[idx_p];
-            const Tcomplex q = input[idx_q];
+            const Tcomplex p = input[idx_p * input_stride];
+            const Tcomplex q = input[idx_q * input_stride];
 
             const Tcomplex u = p + q;
             const Tcomplex v = p - q;
@@ -472,11 +512,11 @@ __global__ static void real_pre_process_kernel(const size_t half_N,
             const Tcomplex twd_p = twiddles[idx_p];
             // NB: twd_q = -conj(twd_p);
 
-            output[idx_p].x = u.x + v.x * twd_p.y - u.y * twd_p.x;
-            output[idx_p].y = v.y + u.y * twd_p.y + v.x * twd_p.x;
+            output[idx_p * output_stride].x = u.x + v.x * twd_p.y - u.y * twd_p.x;
+            output[idx_p * output_stride].y = v.y + u.y * twd_p.y + v.x * twd_p.x;
 
-            output[idx_q].x = u.x - v.x * twd_p.y + u.y * twd_p.x;
-            output[idx_q].y = -v.y + u.y * twd_p.y + v.x * twd_p.x;
+            output[idx_q * output_stride].x = u.x - v.x * twd_p.y + u.y * twd_p.x;
+            output[idx_q * output_stride].y = -v.y + u.y * twd_p.y + v.x * twd_p.x;
         }
     }
 }
@@ -488,8 +528,10 @@ __global__ static void real_pre_process_kernel_planar(const size_t      half_N,
                                                       const size_t      odist1D,
                                                       const void*       input0,
                                                       const void*       input1,
+                                                      const size_t      input_stride,
                                                       const size_t      idist,
                                                       void*             output0,
+                                                      const size_t      output_stride,
                                                       const size_t      odist,
                                                       const void* const twiddles0)
 {
@@ -517,26 +559,26 @@ __global__ static void real_pre_process_kernel_planar(const size_t      half_N,
             // imaginary part at index 0 or at the Nyquist frequency.
 
             Tcomplex p, q;
-            p.x             = inputRe[idx_p];
-            p.y             = inputIm[idx_p];
-            q.x             = inputRe[idx_q];
-            q.y             = inputIm[idx_q];
-            output[idx_p].x = p.x - p.y + q.x + q.y;
-            output[idx_p].y = p.x + p.y - q.x + q.y;
+            p.x                             = inputRe[idx_p * input_stride];
+            p.y                             = inputIm[idx_p * input_stride];
+            q.x                             = inputRe[idx_q * input_stride];
+            q.y                             = inputIm[idx_q * input_stride];
+            output[idx_p * output_stride].x = p.x - p.y + q.x + q.y;
+            output[idx_p * output_stride].y = p.x + p.y - q.x + q.y;
 
             if(Ndiv4)
             {
-                output[quarter_N].x = 2.0 * inputRe[quarter_N];
-                output[quarter_N].y = -2.0 * inputIm[quarter_N];
+                output[quarter_N * output_stride].x = 2.0 * inputRe[quarter_N * input_stride];
+                output[quarter_N * output_stride].y = -2.0 * inputIm[quarter_N * input_stride];
             }
         }
         else
         {
             Tcomplex p, q;
-            p.x = inputRe[idx_p];
-            p.y = inputIm[idx_p];
-            q.x = inputRe[idx_q];
-            q.y = inputIm[idx_q];
+            p.x = inputRe[idx_p * input_stride];
+            p.y = inputIm[idx_p * input_stride];
+            q.x = inputRe[idx_q * input_stride];
+            q.y = inputIm[idx_q * input_stride];
 
             const Tcomplex u = p + q;
             const Tcomplex v = p - q;
@@ -544,11 +586,11 @@ __global__ static void real_pre_process_kernel_planar(const size_t      half_N,
             const Tcomplex twd_p = twiddles[idx_p];
             // NB: twd_q = -conj(twd_p);
 
-            output[idx_p].x = u.x + v.x * twd_p.y - u.y * twd_p.x;
-            output[idx_p].y = v.y + u.y * twd_p.y + v.x * twd_p.x;
+            output[idx_p * output_stride].x = u.x + v.x * twd_p.y - u.y * twd_p.x;
+            output[idx_p * output_stride].y = v.y + u.y * twd_p.y + v.x * twd_p.x;
 
-            output[idx_q].x = u.x - v.x * twd_p.y + u.y * twd_p.x;
-            output[idx_q].y = -v.y + u.y * twd_p.y + v.x * twd_p.x;
+            output[idx_q * output_stride].x = u.x - v.x * twd_p.y + u.y * twd_p.x;
+            output[idx_q * output_stride].y = -v.y + u.y * twd_p.y + v.x * twd_p.x;
         }
     }
 }
@@ -587,8 +629,10 @@ void c2r_1d_pre(const void* data_p, void*)
     // The upper level provides always N/2, that is regular complex fft size
     const size_t half_N = data->node->length[0];
 
-    const size_t idist = data->node->iDist;
-    const size_t odist = data->node->oDist;
+    const size_t input_stride  = data->node->inStride[0];
+    const size_t output_stride = data->node->outStride[0];
+    const size_t idist         = data->node->iDist;
+    const size_t odist         = data->node->oDist;
 
     const void* bufIn0  = data->bufIn[0];
     const void* bufIn1  = data->bufIn[1];
@@ -628,8 +672,10 @@ void c2r_1d_pre(const void* data_p, void*)
                                idist1D,
                                odist1D,
                                bufIn0,
+                               input_stride,
                                idist,
                                bufOut0,
+                               output_stride,
                                odist,
                                data->node->twiddles.data());
         }
@@ -645,8 +691,10 @@ void c2r_1d_pre(const void* data_p, void*)
                                odist1D,
                                bufIn0,
                                bufIn1,
+                               input_stride,
                                idist,
                                bufOut0,
+                               output_stride,
                                odist,
                                data->node->twiddles.data());
         }
@@ -50,6 +50,8 @@ __global__ static void real_post_process_kernel_transpose(size_t        dim,
                                                           const size_t* inStride,
                                                           const size_t* outStride)
 {
+    size_t istride            = inStride[0];
+    size_t ostride            = outStride[0];
     size_t idist1D            = inStride[1];
     size_t odist1D            = outStride[1];
     size_t input_batch_start  = idist * blockIdx.z;
@@ -96,13 +98,14 @@ __global__ static void real_post_process_kernel_transpose(size_t        dim,
 
     if(row_start + lds_row < row_end && lds_col < cols_to_read)
     {
-        auto v                     = Handler<T_I>::read(input0,
-                                    input_batch_start + input_row_base + left_col_start + lds_col);
+        auto v = Handler<T_I>::read(
+            input0, input_batch_start + input_row_base + (left_col_start + lds_col) * istride);
         leftTile[lds_col][lds_row] = v;
 
-        auto v2                     = Handler<T_I>::read(input0,
-                                     input_batch_start + input_row_base
-                                         + (len0 - (left_col_start + cols_to_read - 1)) + lds_col);
+        auto v2 = Handler<T_I>::read(
+            input0,
+            input_batch_start + input_row_base
+                + (len0 - (left_col_start + cols_to_read - 1) + lds_col) * istride);
         rightTile[lds_col][lds_row] = v2;
     }
 
@@ -115,7 +118,8 @@ __global__ static void real_post_process_kernel_transpose(size_t        dim,
 
         if(len0 % 2 == 0)
         {
-            middle_elem = Handler<T_I>::read(input0, input_batch_start + input_row_base + len0 / 2);
+            middle_elem = Handler<T_I>::read(
+                input0, input_batch_start + input_row_base + len0 / 2 * istride);
         }
     }
 
@@ -128,15 +132,15 @@ __global__ static void real_post_process_kernel_transpose(size_t        dim,
         tmp.x = first_elem.x - first_elem.y;
         tmp.y = 0.0;
         Handler<T_O>::write(output0,
-                            output_row_base(dim, output_batch_start, outStride, len0) + row_start
-                                + lds_row,
+                            output_row_base(dim, output_batch_start, outStride, len0)
+                                + (row_start + lds_row) * ostride,
                             tmp);
         T tmp2;
         tmp2.x = first_elem.x + first_elem.y;
         tmp2.y = 0.0;
         Handler<T_O>::write(output0,
-                            output_row_base(dim, output_batch_start, outStride, 0) + row_start
-                                + lds_row,
+                            output_row_base(dim, output_batch_start, outStride, 0)
+                                + (row_start + lds_row) * ostride,
                             tmp2);
 
         if(len0 % 2 == 0)
@@ -147,7 +151,7 @@ __global__ static void real_post_process_kernel_transpose(size_t        dim,
 
             Handler<T_O>::write(output0,
                                 output_row_base(dim, output_batch_start, outStride, middle)
-                                    + row_start + lds_row,
+                                    + (row_start + lds_row) * ostride,
                                 tmp);
         }
     }
@@ -171,14 +175,14 @@ __global__ static void real_post_process_kernel_transpose(size_t        dim,
         tmp.x                 = u.x + v.x * twd_p.y + u.y * twd_p.x;
         tmp.y                 = v.y + u.y * twd_p.y - v.x * twd_p.x;
         auto output_left_base = output_row_base(dim, output_batch_start, outStride, col);
-        Handler<T_O>::write(output0, output_left_base + row_start + lds_row, tmp);
+        Handler<T_O>::write(output0, output_left_base + (row_start + lds_row) * ostride, tmp);
 
         // write right side
         T tmp2;
         tmp2.x                 = u.x - v.x * twd_p.y - u.y * twd_p.x;
         tmp2.y                 = -v.y + u.y * twd_p.y - v.x * twd_p.x;
         auto output_right_base = output_row_base(dim, output_batch_start, outStride, len0 - col);
-        Handler<T_O>::write(output0, output_right_base + row_start + lds_row, tmp2);
+        Handler<T_O>::write(output0, output_right_base + (row_start + lds_row) * ostride, tmp2);
     }
 }
 
@@ -337,6 +341,8 @@ __global__ static void transpose_real_pre_process_kernel(size_t        dim,
                                                          const size_t* inStride,
                                                          const size_t* outStride)
 {
+    size_t istride            = inStride[0];
+    size_t ostride            = outStride[0];
     size_t idist1D            = dim == 2 ? inStride[1] : inStride[2];
     size_t odist1D            = outStride[1];
     size_t input_batch_start  = idist * blockIdx.z;
@@ -385,12 +391,12 @@ __global__ static void transpose_real_pre_process_kernel(size_t        dim,
     if(col_start + lds_col < col_end && lds_row < rows_to_read)
     {
         auto v                    = Handler<T_I>::read(input0,
-                                    input_batch_start + input_col_base + lds_col
+                                    input_batch_start + (input_col_base + lds_col) * istride
                                         + (top_row_start + lds_row) * idist1D);
         topTile[lds_col][lds_row] = v;
 
         auto v2 = Handler<T_I>::read(input0,
-                                     input_batch_start + input_col_base + lds_col
+                                     input_batch_start + (input_col_base + lds_col) * istride
                                          + (len1 - (top_row_start + lds_row)) * idist1D);
         // TODO: reads values-to-butterfly into same col/row in LDS.
         // r2c kernel writes LDS in same order as input.  these
@@ -404,14 +410,15 @@ __global__ static void transpose_real_pre_process_kernel(size_t        dim,
     T last_elem;
     if(blockIdx.y == 0 && threadIdx.y == 0 && col_start + lds_col < col_end)
     {
-        first_elem = Handler<T_I>::read(input0, input_batch_start + col_start + lds_col);
+        first_elem
+            = Handler<T_I>::read(input0, input_batch_start + (col_start + lds_col) * istride);
         if(len1 % 2 == 0)
         {
             middle_elem = Handler<T_I>::read(
-                input0, input_batch_start + col_start + lds_col + middle * idist1D);
+                input0, input_batch_start + (col_start + lds_col) * istride + middle * idist1D);
         }
-        last_elem
-            = Handler<T_I>::read(input0, input_batch_start + col_start + lds_col + len1 * idist1D);
+        last_elem = Handler<T_I>::read(
+            input0, input_batch_start + (col_start + lds_col) * istride + len1 * idist1D);
     }
 
     __syncthreads();
@@ -431,8 +438,10 @@ __global__ static void transpose_real_pre_process_kernel(size_t        dim,
             tmp.x = 2.0 * middle_elem.x;
             tmp.y = -2.0 * middle_elem.y;
 
-            Handler<T_O>::write(
-                output0, output_batch_start + outStride[1] * (col_start + lds_col) + middle, tmp);
+            Handler<T_O>::write(output0,
+                                output_batch_start + outStride[1] * (col_start + lds_col)
+                                    + middle * ostride,
+                                tmp);
         }
     }
 
@@ -454,7 +463,7 @@ __global__ static void transpose_real_pre_process_kernel(size_t        dim,
         tmp.x = u.x + v.x * twd_p.y - u.y * twd_p.x;
         tmp.y = v.y + u.y * twd_p.y + v.x * twd_p.x;
         Handler<T_O>::write(output0,
-                            output_batch_start + top_row_start + lds_row
+                            output_batch_start + (top_row_start + lds_row) * ostride
                                 + (col_start + lds_col) * odist1D,
                             tmp);
 
@@ -463,7 +472,7 @@ __global__ static void transpose_real_pre_process_kernel(size_t        dim,
         tmp2.x = u.x - v.x * twd_p.y + u.y * twd_p.x;
         tmp2.y = -v.y + u.y * twd_p.y + v.x * twd_p.x;
         Handler<T_O>::write(output0,
-                            output_batch_start + (len1 - (top_row_start + lds_row))
+                            output_batch_start + (len1 - (top_row_start + lds_row)) * ostride
                                 + (col_start + lds_col) * odist1D,
                             tmp2);
     }
@@ -270,18 +270,217 @@ void complex2pair_unpack(const void* data_p, void*)
     }
 }
 
-// FIXME: document
+/// Kernels for packing two complex arrays with Hermitian symmetry into one complex array
+/// which is the input of a c2c transform whose output is two real arrays x and y.
+///
+/// That is, given the Hermitian-symmetric halves of X and Y, we compute
+///
+/// Z_r = X_r + i Y_r
+///
+/// for r = 0, ... , N - 1, where X_r = X_{N - r}^* and Y_r = Y_{N - r}^* for r > \floor{N/2}.
+///
+/// Z is written in planar format so that the inverse c2c transform produces x in the real
+/// part and y in the imaginary part.
+
+/// Interleaved data version.
+template <typename Treal>
+__global__ static void pair2complex_pack_kernel(const size_t                 N,
+                                                const complex_type_t<Treal>* input,
+                                                const size_t                 ioffset,
+                                                const size_t                 istride,
+                                                const size_t                 idist,
+                                                Treal*                       output,
+                                                const size_t                 ooffset,
+                                                const size_t                 ostride,
+                                                const size_t                 odist)
+{
+    const size_t idx = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(idx < N)
+    {
+        const auto inputX = input + blockIdx.z * idist;
+        const auto inputY = inputX + ioffset;
+
+        auto outputRe = output + blockIdx.z * odist;
+        auto outputIm = outputRe + ooffset;
+
+        // Only the first \floor{N/2} + 1 values are stored; the rest
+        // are the complex conjugates of their mirror images.
+        const bool   lower = idx <= N / 2;
+        const size_t idx_h = lower ? idx : N - idx;
+
+        complex_type_t<Treal> X = inputX[idx_h * istride];
+        complex_type_t<Treal> Y = inputY[idx_h * istride];
+        if(!lower)
+        {
+            X.y = -X.y;
+            Y.y = -Y.y;
+        }
+
+        outputRe[idx * ostride] = X.x - Y.y;
+        outputIm[idx * ostride] = X.y + Y.x;
+    }
+}
+
+/// Planar data version.
 template <typename Treal>
-__global__ static void pair2complex_pack_kernel()
+__global__ static void pair2complex_pack_kernel(const size_t N,
+                                                const Treal* inputRe,
+                                                const Treal* inputIm,
+                                                const size_t ioffset,
+                                                const size_t istride,
+                                                const size_t idist,
+                                                Treal*       output,
+                                                const size_t ooffset,
+                                                const size_t ostride,
+                                                const size_t odist)
 {
-    // FIXME: implement
+    const size_t idx = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(idx < N)
+    {
+        const auto inputXRe = inputRe + blockIdx.z * idist;
+        const auto inputYRe = inputXRe + ioffset;
+
+        const auto inputXIm = inputIm + blockIdx.z * idist;
+        const auto inputYIm = inputXIm + ioffset;
+
+        auto outputRe = output + blockIdx.z * odist;
+        auto outputIm = outputRe + ooffset;
+
+        const bool   lower = idx <= N / 2;
+        const size_t idx_h = lower ? idx : N - idx;
+
+        const Treal XRe = inputXRe[idx_h * istride];
+        const Treal YRe = inputYRe[idx_h * istride];
+        const Treal XIm = lower ? inputXIm[idx_h * istride] : -inputXIm[idx_h * istride];
+        const Treal YIm = lower ? inputYIm[idx_h * istride] : -inputYIm[idx_h * istride];
+
+        outputRe[idx * ostride] = XRe - YIm;
+        outputIm[idx * ostride] = XIm + YRe;
+    }
 }
 
 /// Pack two (Hermitian-symmetric) complex arrays into full-length complex array for a
 /// complex-to-real transform.
 void pair2complex_pack(const void* data_p, void*)
 {
-    // FIXME: implement
     const DeviceCallIn* data = (DeviceCallIn*)data_p;
-    assert(false);
+
+    const size_t idist   = data->node->iDist;
+    const size_t odist   = data->node->oDist;
+    const size_t istride = data->node->inStride[0];
+    const size_t ostride = data->node->outStride[0];
+
+    void* bufIn0  = data->bufIn[0];
+    void* bufIn1  = data->bufIn[1];
+    void* bufOut0 = data->bufOut[0];
+
+    const ptrdiff_t ioffset = (data->node->parent->batch % 2 == 0)
+                                  ? idist / 2
+                                  : data->node->inStride[data->node->pairdim];
+
+    const ptrdiff_t ooffset = (data->node->parent->batch % 2 == 0)
+                                  ? odist / 2
+                                  : data->node->outStride[data->node->pairdim];
+
+    const size_t N              = data->node->length[0];
+    const size_t high_dimension = std::accumulate(
+        data->node->length.begin() + 1, data->node->length.end(), 1, std::multiplies<size_t>());
+    const size_t batch = data->node->batch;
+
+    const size_t block_size = 512;
+    size_t       blocks     = (N + block_size - 1) / block_size;
+
+    dim3 grid(blocks, high_dimension, batch);
+    dim3 threads(block_size, 1, 1);
+
+    switch(data->node->inArrayType)
+    {
+    case rocfft_array_type_hermitian_interleaved:
+        switch(data->node->precision)
+        {
+        case rocfft_precision_single:
+            hipLaunchKernelGGL(pair2complex_pack_kernel<float>,
+                               grid,
+                               threads,
+                               0,
+                               data->rocfft_stream,
+                               N,
+                               (complex_type_t<float>*)bufIn0,
+                               ioffset,
+                               istride,
+                               idist,
+                               (float*)bufOut0,
+                               ooffset,
+                               ostride,
+                               odist);
+            break;
+        case rocfft_precision_double:
+            hipLaunchKernelGGL(pair2complex_pack_kernel<double>,
+                               grid,
+                               threads,
+                               0,
+                               data->rocfft_stream,
+                               N,
+                               (complex_type_t<double>*)bufIn0,
+                               ioffset,
+                               istride,
+                               idist,
+                               (double*)bufOut0,
+                               ooffset,
+                               ostride,
+                               odist);
+            break;
+        default:
+            std::cerr << "invalid precision for pair2complex\n";
+            assert(false);
+        }
+        break;
+    case rocfft_array_type_hermitian_planar:
+        switch(data->node->precision)
+        {
+        case rocfft_precision_single:
+            hipLaunchKernelGGL(pair2complex_pack_kernel<float>,
+                               grid,
+                               threads,
+                               0,
+                               data->rocfft_stream,
+                               N,
+                               (float*)bufIn0,
+                               (float*)bufIn1,
+                               ioffset,
+                               istride,
+                               idist,
+                               (float*)bufOut0,
+                               ooffset,
+                               ostride,
+                               odist);
+            break;
+        case rocfft_precision_double:
+            hipLaunchKernelGGL(pair2complex_pack_kernel<double>,
+                               grid,
+                               threads,
+                               0,
+                               data->rocfft_stream,
+                               N,
+                               (double*)bufIn0,
+                               (double*)bufIn1,
+                               ioffset,
+                               istride,
+                               idist,
+                               (double*)bufOut0,
+                               ooffset,
+                               ostride,
+                               odist);
+            break;
+        default:
+            std::cerr << "invalid precision for pair2complex\n";
+            assert(false);
+        }
+        break;
+    default:
+        std::cerr << "invalid input type for pair2complex" << std::endl;
+        assert(false);
+    }
 }
@@ -23,6 +23,106 @@
 #include "rocfft_hip.h"
 #include <iostream>
 
+// Instantiations of the transpose kernels, indexed by their runtime
+// template parameters.  The tables are built once per type
+// combination, so selecting a kernel at launch time is just an index.
+
+#define TRANSPOSE_KERNEL2(TWL, DIR, ALL, UNIT_STRIDE_0, DIAGONAL)                                \
+    &HIP_KERNEL_NAME(transpose_kernel2<T,                                                        \
+                                       TA,                                                       \
+                                       TB,                                                       \
+                                       TRANSPOSE_DIM_X,                                          \
+                                       TRANSPOSE_DIM_Y,                                          \
+                                       true,                                                     \
+                                       TWL,                                                      \
+                                       DIR,                                                      \
+                                       ALL,                                                      \
+                                       UNIT_STRIDE_0,                                            \
+                                       DIAGONAL>)
+#define TRANSPOSE_KERNEL2_DIAGONAL(TWL, DIR, ALL, UNIT_STRIDE_0)                                 \
+    {                                                                                            \
+        TRANSPOSE_KERNEL2(TWL, DIR, ALL, UNIT_STRIDE_0, false),                                  \
+            TRANSPOSE_KERNEL2(TWL, DIR, ALL, UNIT_STRIDE_0, true)                                \
+    }
+#define TRANSPOSE_KERNEL2_UNIT_STRIDE_0(TWL, DIR, ALL)                                           \
+    {                                                                                            \
+        TRANSPOSE_KERNEL2_DIAGONAL(TWL, DIR, ALL, false),                                        \
+            TRANSPOSE_KERNEL2_DIAGONAL(TWL, DIR, ALL, true)                                      \
+    }
+#define TRANSPOSE_KERNEL2_ALL(TWL, DIR)                                                          \
+    {                                                                                            \
+        TRANSPOSE_KERNEL2_UNIT_STRIDE_0(TWL, DIR, false),                                        \
+            TRANSPOSE_KERNEL2_UNIT_STRIDE_0(TWL, DIR, true)                                      \
+    }
+#define TRANSPOSE_KERNEL2_DIR(TWL)                                                               \
+    {                                                                                            \
+        TRANSPOSE_KERNEL2_ALL(TWL, -1), TRANSPOSE_KERNEL2_ALL(TWL, 1)                            \
+    }
+
+template <typename T, typename TA, typename TB, int TRANSPOSE_DIM_X, int TRANSPOSE_DIM_Y>
+struct transpose_kernel2_table
+{
+    typedef decltype(TRANSPOSE_KERNEL2(0, -1, true, true, true)) kernel_t;
+
+    // Return the kernel for the given parameters, or nullptr if there
+    // is no such instantiation.
+    static kernel_t get(int twl, int dir, bool all, bool unit_stride0, bool diagonal)
+    {
+        // indexed by [TWL][DIR][ALL][UNIT_STRIDE_0][DIAGONAL]; TWL is
+        // 0, 2, 3 or 4
+        static const kernel_t kernels[4][2][2][2][2] = {TRANSPOSE_KERNEL2_DIR(0),
+                                                        TRANSPOSE_KERNEL2_DIR(2),
+                                                        TRANSPOSE_KERNEL2_DIR(3),
+                                                        TRANSPOSE_KERNEL2_DIR(4)};
+
+        if(twl < 0 || twl == 1 || twl > 4 || (dir != -1 && dir != 1))
+            return nullptr;
+        const int twl_index = twl == 0 ? 0 : twl - 1;
+        const int dir_index = dir == -1 ? 0 : 1;
+        return kernels[twl_index][dir_index][all][unit_stride0][diagonal];
+    }
+};
+
+#undef TRANSPOSE_KERNEL2_DIR
+#undef TRANSPOSE_KERNEL2_ALL
+#undef TRANSPOSE_KERNEL2_UNIT_STRIDE_0
+#undef TRANSPOSE_KERNEL2_DIAGONAL
+#undef TRANSPOSE_KERNEL2
+
+#define TRANSPOSE_KERNEL2_SCHEME(ALL, UNIT_STRIDE_0, DIAGONAL)                                   \
+    &HIP_KERNEL_NAME(transpose_kernel2_scheme<T,                                                 \
+                                              TA,                                                \
+                                              TB,                                                \
+                                              TRANSPOSE_DIM_X,                                   \
+                                              TRANSPOSE_DIM_Y,                                   \
+                                              ALL,                                               \
+                                              UNIT_STRIDE_0,                                     \
+                                              DIAGONAL>)
+
+template <typename T, typename TA, typename TB, int TRANSPOSE_DIM_X, int TRANSPOSE_DIM_Y>
+struct transpose_kernel2_scheme_table
+{
+    typedef decltype(TRANSPOSE_KERNEL2_SCHEME(true, true, true)) kernel_t;
+
+    static kernel_t get(bool all, bool unit_stride0, bool diagonal)
+    {
+        // indexed by [ALL][UNIT_STRIDE_0][DIAGONAL]
+        static const kernel_t kernels[2][2][2]
+            = {{{TRANSPOSE_KERNEL2_SCHEME(false, false, false),
+                 TRANSPOSE_KERNEL2_SCHEME(false, false, true)},
+                {TRANSPOSE_KERNEL2_SCHEME(false, true, false),
+                 TRANSPOSE_KERNEL2_SCHEME(false, true, true)}},
+               {{TRANSPOSE_KERNEL2_SCHEME(true, false, false),
+                 TRANSPOSE_KERNEL2_SCHEME(true, false, true)},
+                {TRANSPOSE_KERNEL2_SCHEME(true, true, false),
+                 TRANSPOSE_KERNEL2_SCHEME(true, true, true)}}};
+
+        return kernels[all][unit_stride0][diagonal];
+    }
+};
+
+#undef TRANSPOSE_KERNEL2_SCHEME
+
 /// \brief FFT Transpose out-of-place API
 /// \details transpose matrix A of size (m row by n cols) to matrix B (n row by m cols)
 ///    both A and B are in row major
@@ -60,455 +160,52 @@ rocfft_status rocfft_transpose_outofplace_template(size_t      m,
 
     if(scheme == 0)
     {
-        // Create a map from the parameters to the templated function
-        std::map<std::tuple<int, int, bool, bool, bool>, // TWL, DIR, ALL, UNIT_STRIDE_0, DIAGONAL
-                 decltype(&HIP_KERNEL_NAME(transpose_kernel2<T,
-                                                             TA,
-                                                             TB,
-                                                             TRANSPOSE_DIM_X,
-                                                             TRANSPOSE_DIM_Y,
-                                                             true,
-                                                             2,
-                                                             -1,
-                                                             true,
-                                                             true,
-                                                             true>))>
-            tmap;
-        // Fill the map with explicitly instantiated templates:
-
-        // clang-format off
-        // twl=0:
-        tmap.emplace(
-            std::make_tuple(0, -1, true, true, true),
-            &HIP_KERNEL_NAME(
-                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, 0, -1, true, true, true>));
-        tmap.emplace(
-            std::make_tuple(0, -1, false, true, true),
-            &HIP_KERNEL_NAME(
-                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, 0, -1, false, true, true>));
-        tmap.emplace(
-            std::make_tuple(0, -1, true, false, true),
-            &HIP_KERNEL_NAME(
-                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, 0, -1, true, false, true>));
-        tmap.emplace(
-            std::make_tuple(0, -1, false, false, true),
-            &HIP_KERNEL_NAME(
-                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, 0, -1, false, false, true>));
-
-        tmap.emplace(
-            std::make_tuple(0, 1, true, true, true),
-            &HIP_KERNEL_NAME(
-                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, 0, 1, true, true, true>));
-        tmap.emplace(
-            std::make_tuple(0, 1, false, true, true),
-            &HIP_KERNEL_NAME(
-                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, 0, 1, false, true, true>));
-
-        tmap.emplace(
-            std::make_tuple(0, 1, true, false, true),
-            &HIP_KERNEL_NAME(
-                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, 0, 1, true, false, true>));
-        tmap.emplace(
-            std::make_tuple(0, 1, false, false, true),
-            &HIP_KERNEL_NAME(
-                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, 0, 1, false, false, true>));
-
-        tmap.emplace(
-            std::make_tuple(0, -1, true, true, false),
-            &HIP_KERNEL_NAME(
-                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, 0, -1, true, true, false>));
-        tmap.emplace(
-            std::make_tuple(0, -1, false, true, false),
-            &HIP_KERNEL_NAME(
-                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, 0, -1, false, true, false>));
-        tmap.emplace(
-            std::make_tuple(0, -1, true, false, false),
-            &HIP_KERNEL_NAME(
-                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, 0, -1, true, false, false>));
-        tmap.emplace(
-            std::make_tuple(0, -1, false, false, false),
-            &HIP_KERNEL_NAME(
-                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, 0, -1, false, false, false>));
-
-        tmap.emplace(
-            std::make_tuple(0, 1, true, true, false),
-            &HIP_KERNEL_NAME(
-                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, 0, 1, true, true, false>));
-        tmap.emplace(
-            std::make_tuple(0, 1, false, true, false),
-            &HIP_KERNEL_NAME(
-                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, 0, 1, false, true, false>));
-
-        tmap.emplace(
-            std::make_tuple(0, 1, true, false, false),
-            &HIP_KERNEL_NAME(
-                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, 0, 1, true, false, false>));
-        tmap.emplace(
-            std::make_tuple(0, 1, false, false, false),
-            &HIP_KERNEL_NAME(
-                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, 0, 1, false, false, false>));
-
-        // twl=2:
-        tmap.emplace(
-            std::make_tuple(2, -1, true, true, true),
-            &HIP_KERNEL_NAME(
-                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, 2, -1, true, true, true>));
-        tmap.emplace(
-            std::make_tuple(2, -1, false, true, true),
-            &HIP_KERNEL_NAME(
-                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, 2, -1, false, true, true>));
-        tmap.emplace(
-            std::make_tuple(2, -1, true, false, true),
-            &HIP_KERNEL_NAME(
-                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, 2, -1, true, false, true>));
-        tmap.emplace(
-            std::make_tuple(2, -1, false, false, true),
-            &HIP_KERNEL_NAME(
-                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, 2, -1, false, false, true>));
-
-        tmap.emplace(
-            std::make_tuple(2, 1, true, true, true),
-            &HIP_KERNEL_NAME(
-                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, 2, 1, true, true, true>));
-        tmap.emplace(
-            std::make_tuple(2, 1, false, true, true),
-            &HIP_KERNEL_NAME(
-                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, 2, 1, false, true, true>));
-
-        tmap.emplace(
-            std::make_tuple(2, 1, true, false, true),
-            &HIP_KERNEL_NAME(
-                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, 2, 1, true, false, true>));
-        tmap.emplace(
-            std::make_tuple(2, 1, false, false, true),
-            &HIP_KERNEL_NAME(
-                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, 2, 1, false, false, true>));
-
-        tmap.emplace(
-            std::make_tuple(2, -1, true, true, false),
-            &HIP_KERNEL_NAME(
-                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, 2, -1, true, true, false>));
-        tmap.emplace(
-            std::make_tuple(2, -1, false, true, false),
-            &HIP_KERNEL_NAME(
-                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, 2, -1, false, true, false>));
-        tmap.emplace(
-            std::make_tuple(2, -1, true, false, false),
-            &HIP_KERNEL_NAME(
-                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, 2, -1, true, false, false>));
-        tmap.emplace(
-            std::make_tuple(2, -1, false, false, false),
-            &HIP_KERNEL_NAME(
-                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, 2, -1, false, false, false>));
-
-        tmap.emplace(
-            std::make_tuple(2, 1, true, true, false),
-            &HIP_KERNEL_NAME(
-                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, 2, 1, true, true, false>));
-        tmap.emplace(
-            std::make_tuple(2, 1, false, true, false),
-            &HIP_KERNEL_NAME(
-                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, 2, 1, false, true, false>));
-
-        tmap.emplace(
-            std::make_tuple(2, 1, true, false, false),
-            &HIP_KERNEL_NAME(
-                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, 2, 1, true, false, false>));
-        tmap.emplace(
-            std::make_tuple(2, 1, false, false, false),
-            &HIP_KERNEL_NAME(
-                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, 2, 1, false, false, false>));
-
-        // twl=3:
-        tmap.emplace(
-            std::make_tuple(3, -1, true, true, true),
-            &HIP_KERNEL_NAME(
-                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, 3, -1, true, true, true>));
-        tmap.emplace(
-            std::make_tuple(3, -1, false, true, true),
-            &HIP_KERNEL_NAME(
-                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, 3, -1, false, true, true>));
-        tmap.emplace(
-            std::make_tuple(3, -1, true, false, true),
-            &HIP_KERNEL_NAME(
-                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, 3, -1, true, false, true>));
-        tmap.emplace(
-            std::make_tuple(3, -1, false, false, true),
-            &HIP_KERNEL_NAME(
-                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, 3, -1, false, false, true>));
-
-        tmap.emplace(
-            std::make_tuple(3, 1, true, true, true),
-            &HIP_KERNEL_NAME(
-                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, 3, 1, true, true, true>));
-        tmap.emplace(
-            std::make_tuple(3, 1, false, true, true),
-            &HIP_KERNEL_NAME(
-                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, 3, 1, false, true, true>));
-        tmap.emplace(
-            std::make_tuple(3, 1, true, false, true),
-            &HIP_KERNEL_NAME(
-                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, 3, 1, true, false, true>));
-        tmap.emplace(
-            std::make_tuple(3, 1, false, false, true),
-            &HIP_KERNEL_NAME(
-                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, 3, 1, false, false, true>));
-
-        tmap.emplace(
-            std::make_tuple(3, -1, true, true, false),
-            &HIP_KERNEL_NAME(
-                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, 3, -1, true, true, false>));
-        tmap.emplace(
-            std::make_tuple(3, -1, false, true, false),
-            &HIP_KERNEL_NAME(
-                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, 3, -1, false, true, false>));
-        tmap.emplace(
-            std::make_tuple(3, -1, true, false, false),
-            &HIP_KERNEL_NAME(
-                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, 3, -1, true, false, false>));
-        tmap.emplace(
-            std::make_tuple(3, -1, false, false, false),
-            &HIP_KERNEL_NAME(
-                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, 3, -1, false, false, false>));
-
-        tmap.emplace(
-            std::make_tuple(3, 1, true, true, false),
-            &HIP_KERNEL_NAME(
-                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, 3, 1, true, true, false>));
-        tmap.emplace(
-            std::make_tuple(3, 1, false, true, false),
-            &HIP_KERNEL_NAME(
-                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, 3, 1, false, true, false>));
-        tmap.emplace(
-            std::make_tuple(3, 1, true, false, false),
-            &HIP_KERNEL_NAME(
-                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, 3, 1, true, false, false>));
-        tmap.emplace(
-            std::make_tuple(3, 1, false, false, false),
-            &HIP_KERNEL_NAME(
-                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, 3, 1, false, false, false>));
-
-        // twl=4:
-        tmap.emplace(
-            std::make_tuple(4, -1, true, true, true),
-            &HIP_KERNEL_NAME(
-                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, 4, -1, true, true, true>));
-        tmap.emplace(
-            std::make_tuple(4, -1, false, true, true),
-            &HIP_KERNEL_NAME(
-                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, 4, -1, false, true, true>));
-        tmap.emplace(
-            std::make_tuple(4, -1, true, false, true),
-            &HIP_KERNEL_NAME(
-                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, 4, -1, true, false, true>));
-        tmap.emplace(
-            std::make_tuple(4, -1, false, false, true),
-            &HIP_KERNEL_NAME(
-                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, 4, -1, false, false, true>));
-
-        tmap.emplace(
-            std::make_tuple(4, 1, true, true, true),
-            &HIP_KERNEL_NAME(
-                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, 4, 1, true, true, true>));
-        tmap.emplace(
-            std::make_tuple(4, 1, false, true, true),
-            &HIP_KERNEL_NAME(
-                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, 4, 1, false, true, true>));
-        tmap.emplace(
-            std::make_tuple(4, 1, true, false, true),
-            &HIP_KERNEL_NAME(
-                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, 4, 1, true, false, true>));
-        tmap.emplace(
-            std::make_tuple(4, 1, false, false, true),
-            &HIP_KERNEL_NAME(
-                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, 4, 1, false, false, true>));
-
-
-        tmap.emplace(
-            std::make_tuple(4, -1, true, true, false),
-            &HIP_KERNEL_NAME(
-                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, 4, -1, true, true, false>));
-        tmap.emplace(
-            std::make_tuple(4, -1, false, true, false),
-            &HIP_KERNEL_NAME(
-                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, 4, -1, false, true, false>));
-        tmap.emplace(
-            std::make_tuple(4, -1, true, false, false),
-            &HIP_KERNEL_NAME(
-                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, 4, -1, true, false, false>));
-        tmap.emplace(
-            std::make_tuple(4, -1, false, false, false),
-            &HIP_KERNEL_NAME(
-                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, 4, -1, false, false, false>));
-
-        tmap.emplace(
-            std::make_tuple(4, 1, true, true, false),
-            &HIP_KERNEL_NAME(
-                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, 4, 1, true, true, false>));
-        tmap.emplace(
-            std::make_tuple(4, 1, false, true, false),
-            &HIP_KERNEL_NAME(
-                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, 4, 1, false, true, false>));
-        tmap.emplace(
-            std::make_tuple(4, 1, true, false, false),
-            &HIP_KERNEL_NAME(
-                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, 4, 1, true, false, false>));
-        tmap.emplace(
-            std::make_tuple(4, 1, false, false, false),
-            &HIP_KERNEL_NAME(
-                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, 4, 1, false, false, false>));
-        // clang-format on
-
-        // Tuple containing template parameters for transpose TWL, DIR, ALL, UNIT_STRIDE_0, DIAGONAL
-        const std::tuple<int, int, bool, bool, bool> tparams
-            = std::make_tuple(twl, dir, all, unit_stride0, diagonal);
-
-        try
-        {
-            hipLaunchKernelGGL(tmap.at(tparams),
-                               dim3(grid),
-                               dim3(threads),
-                               0,
-                               rocfft_stream,
-                               A,
-                               B,
-                               (T*)twiddles_large,
-                               lengths,
-                               stride_in,
-                               stride_out);
-        }
-        catch(std::exception& e)
+        auto kernel = transpose_kernel2_table<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y>::get(
+            twl, dir, all, unit_stride0, diagonal);
+        if(kernel == nullptr)
         {
             rocfft_cout << "scheme: " << scheme << std::endl;
             rocfft_cout << "twl: " << twl << std::endl;
             rocfft_cout << "dir: " << dir << std::endl;
             rocfft_cout << "all: " << all << std::endl;
             rocfft_cout << "diagonal: " << diagonal << std::endl;
-            rocfft_cout << e.what() << '\n';
+            rocfft_cout << "no transpose kernel for these parameters\n";
+            return rocfft_status_failure;
         }
+
+        hipLaunchKernelGGL(kernel,
+                           dim3(grid),
+                           dim3(threads),
+                           0,
+                           rocfft_stream,
+                           A,
+                           B,
+                           (T*)twiddles_large,
+                           lengths,
+                           stride_in,
+                           stride_out);
     }
     else
     {
-        // Create a map from the parameters to the templated function
-        std::map<std::tuple<bool, bool, bool>, // ALL, UNIT_STRIDE_0, DIAGONAL
-                 decltype(&HIP_KERNEL_NAME(transpose_kernel2_scheme<T,
-                                                                    TA,
-                                                                    TB,
-                                                                    TRANSPOSE_DIM_X,
-                                                                    TRANSPOSE_DIM_Y,
-                                                                    true,
-                                                                    true,
-                                                                    true>))>
-            tmap;
-
-        // Fill the map with explicitly instantiated templates:
-        tmap.emplace(std::make_tuple(true, true, true),
-                     &HIP_KERNEL_NAME(transpose_kernel2_scheme<T,
-                                                               TA,
-                                                               TB,
-                                                               TRANSPOSE_DIM_X,
-                                                               TRANSPOSE_DIM_Y,
-                                                               true,
-                                                               true,
-                                                               true>));
-        tmap.emplace(std::make_tuple(false, true, true),
-                     &HIP_KERNEL_NAME(transpose_kernel2_scheme<T,
-                                                               TA,
-                                                               TB,
-                                                               TRANSPOSE_DIM_X,
-                                                               TRANSPOSE_DIM_Y,
-                                                               false,
-                                                               true,
-                                                               true>));
-        tmap.emplace(std::make_tuple(true, false, true),
-                     &HIP_KERNEL_NAME(transpose_kernel2_scheme<T,
-                                                               TA,
-                                                               TB,
-                                                               TRANSPOSE_DIM_X,
-                                                               TRANSPOSE_DIM_Y,
-                                                               true,
-                                                               false,
-                                                               true>));
-        tmap.emplace(std::make_tuple(true, true, false),
-                     &HIP_KERNEL_NAME(transpose_kernel2_scheme<T,
-                                                               TA,
-                                                               TB,
-                                                               TRANSPOSE_DIM_X,
-                                                               TRANSPOSE_DIM_Y,
-                                                               true,
-                                                               true,
-                                                               false>));
-
-        tmap.emplace(std::make_tuple(true, false, false),
-                     &HIP_KERNEL_NAME(transpose_kernel2_scheme<T,
-                                                               TA,
-                                                               TB,
-                                                               TRANSPOSE_DIM_X,
-                                                               TRANSPOSE_DIM_Y,
-                                                               true,
-                                                               false,
-                                                               false>));
-
-        tmap.emplace(std::make_tuple(false, false, true),
-                     &HIP_KERNEL_NAME(transpose_kernel2_scheme<T,
-                                                               TA,
-                                                               TB,
-                                                               TRANSPOSE_DIM_X,
-                                                               TRANSPOSE_DIM_Y,
-                                                               false,
-                                                               false,
-                                                               true>));
-
-        tmap.emplace(std::make_tuple(false, true, false),
-                     &HIP_KERNEL_NAME(transpose_kernel2_scheme<T,
-                                                               TA,
-                                                               TB,
-                                                               TRANSPOSE_DIM_X,
-                                                               TRANSPOSE_DIM_Y,
-                                                               false,
-                                                               true,
-                                                               false>));
-
-        tmap.emplace(std::make_tuple(false, false, false),
-                     &HIP_KERNEL_NAME(transpose_kernel2_scheme<T,
-                                                               TA,
-                                                               TB,
-                                                               TRANSPOSE_DIM_X,
-                                                               TRANSPOSE_DIM_Y,
-                                                               false,
-                                                               false,
-                                                               false>));
-
-        // Tuple containing template parameters for transpose ALL, UNIT_STRIDE_0, DIAGONAL
-        const std::tuple<bool, bool, bool> tparams = std::make_tuple(all, unit_stride0, diagonal);
-
-        try
-        {
-            hipLaunchKernelGGL(tmap.at(tparams),
-                               dim3(grid),
-                               dim3(threads),
-                               0,
-                               rocfft_stream,
-                               A,
-                               B,
-                               (T*)twiddles_large,
-                               lengths,
-                               stride_in,
-                               stride_out,
-                               ld_in,
-                               ld_out,
-                               m,
-                               n);
-        }
-        catch(std::exception& e)
-        {
-            rocfft_cout << "scheme: " << scheme << std::endl;
-            rocfft_cout << "twl: " << twl << std::endl;
-            rocfft_cout << "dir: " << dir << std::endl;
-            rocfft_cout << "all: " << all << std::endl;
-            rocfft_cout << "diagonal: " << diagonal << std::endl;
-            rocfft_cout << e.what() << '\n';
-        }
+        auto kernel
+            = transpose_kernel2_scheme_table<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y>::get(
+                all, unit_stride0, diagonal);
+
+        hipLaunchKernelGGL(kernel,
+                           dim3(grid),
+                           dim3(threads),
+                           0,
+                           rocfft_stream,
+                           A,
+                           B,
+                           (T*)twiddles_large,
+                           lengths,
+                           stride_in,
+                           stride_out,
+                           ld_in,
+                           ld_out,
+                           m,
+                           n);
     }
 
     return rocfft_status_success;
@@ -54,47 +54,14 @@ std::vector<size_t> GetRadices(size_t length)
     // if not in the table, then generate the radice order with the algorithm.
     if(radices.size() == 0)
     {
-        size_t R = length;
-
-        // Possible radices
-        size_t cRad[]   = {13, 11, 10, 8, 7, 6, 5, 4, 3, 2, 1}; // Must be in descending order
-        size_t cRadSize = (sizeof(cRad) / sizeof(cRad[0]));
-
         size_t workGroupSize;
         size_t numTrans;
         // need to know workGroupSize and numTrans
         DetermineSizes(length, workGroupSize, numTrans);
         size_t cnPerWI = (numTrans * length) / workGroupSize;
 
-        // Generate the radix and pass objects
-        while(true)
-        {
-            size_t rad;
-
-            // Picks the radices in descending order (biggest radix first) performance
-            // purpose
-            for(size_t r = 0; r < cRadSize; r++)
-            {
-
-                rad = cRad[r];
-                if((rad > cnPerWI) || (cnPerWI % rad))
-                    continue;
-
-                if(!(R % rad)) // if not a multiple of rad, then exit
-                    break;
-            }
-
-            assert((cnPerWI % rad) == 0);
-
-            R /= rad;
-            radices.push_back(rad);
-
-            assert(R >= 1);
-            if(R == 1)
-                break;
-
-        } // end while
-    } // end if(radices == empty)
+        radices = DetermineRadices(length, cnPerWI);
+    }
 
     return radices;
 }
@@ -0,0 +1,261 @@
+/******************************************************************************
+* Copyright (c) 2016 - present Advanced Micro Devices, Inc. All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*******************************************************************************/
+
+#include <algorithm>
+#include <numeric>
+#include <tuple>
+
+#include "grouped_plan.h"
+#include "logging.h"
+#include "plan.h"
+#include "transform.h"
+
+// Create a batched plan for one run of problems
+static rocfft_status CreateRunPlan(rocfft_plan*                  plan,
+                                   const rocfft_result_placement placement,
+                                   const rocfft_transform_type   transform_type,
+                                   const rocfft_precision        precision,
+                                   size_t                        length,
+                                   size_t                        batch,
+                                   size_t                        in_stride,
+                                   size_t                        in_distance,
+                                   size_t                        out_stride,
+                                   size_t                        out_distance)
+{
+    rocfft_plan_description desc = nullptr;
+    rocfft_status           ret  = rocfft_plan_description_create(&desc);
+    if(ret != rocfft_status_success)
+        return ret;
+    ret = rocfft_plan_description_set_data_layout(desc,
+                                                  rocfft_array_type_complex_interleaved,
+                                                  rocfft_array_type_complex_interleaved,
+                                                  nullptr,
+                                                  nullptr,
+                                                  1,
+                                                  &in_stride,
+                                                  in_distance,
+                                                  1,
+                                                  &out_stride,
+                                                  out_distance);
+    if(ret == rocfft_status_success)
+        ret = rocfft_plan_create(
+            plan, placement, transform_type, precision, 1, &length, batch, desc);
+    rocfft_plan_description_destroy(desc);
+    return ret;
+}
+
+rocfft_status rocfft_grouped_plan_create(rocfft_grouped_plan*          plan,
+                                         const rocfft_result_placement placement,
+                                         const rocfft_transform_type   transform_type,
+                                         const rocfft_precision        precision,
+                                         const size_t                  num_problems,
+                                         const size_t*                 lengths,
+                                         const size_t*                 in_offsets,
+                                         const size_t*                 in_strides,
+                                         const size_t*                 out_offsets,
+                                         const size_t*                 out_strides)
+{
+    log_trace(__func__,
+              "plan",
+              plan,
+              "placement",
+              placement,
+              "transform_type",
+              transform_type,
+              "precision",
+              precision,
+              "num_problems",
+              num_problems,
+              "lengths",
+              std::make_pair(lengths, num_problems),
+              "in_offsets",
+              std::make_pair(in_offsets, num_problems),
+              "in_strides",
+              std::make_pair(in_strides, num_problems),
+              "out_offsets",
+              std::make_pair(out_offsets, num_problems),
+              "out_strides",
+              std::make_pair(out_strides, num_problems));
+
+    if(!plan || !lengths || !in_offsets || num_problems == 0)
+        return rocfft_status_invalid_arg_value;
+    if(transform_type != rocfft_transform_type_complex_forward
+       && transform_type != rocfft_transform_type_complex_inverse)
+        return rocfft_status_invalid_arg_value;
+    if(placement == rocfft_placement_notinplace && !out_offsets)
+        return rocfft_status_invalid_arg_value;
+
+    // in-place problems are written where they are read
+    bool inplace = placement == rocfft_placement_inplace;
+    auto problem = [&](size_t i) {
+        size_t in_stride  = in_strides ? in_strides[i] : 1;
+        size_t out_stride = inplace ? in_stride : (out_strides ? out_strides[i] : 1);
+        size_t out_offset = inplace ? in_offsets[i] : out_offsets[i];
+        return std::make_tuple(lengths[i], in_stride, out_stride, in_offsets[i], out_offset);
+    };
+    for(size_t i = 0; i < num_problems; ++i)
+    {
+        if(lengths[i] == 0 || std::get<1>(problem(i)) == 0 || std::get<2>(problem(i)) == 0)
+            return rocfft_status_invalid_arg_value;
+    }
+
+    // sort by length and strides, then by offset, so that problems
+    // that can share a batched plan are adjacent
+    std::vector<size_t> order(num_problems);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        return problem(a) < problem(b);
+    });
+
+    rocfft_grouped_plan p = new rocfft_grouped_plan_t;
+    p->placement          = placement;
+    p->elemSize = (precision == rocfft_precision_single) ? sizeof(float) * 2 : sizeof(double) * 2;
+
+    for(size_t start = 0; start < num_problems;)
+    {
+        size_t length, in_stride, out_stride, in_offset, out_offset;
+        std::tie(length, in_stride, out_stride, in_offset, out_offset) = problem(order[start]);
+
+        // elements spanned by one problem; batching problems that are
+        // closer together than this would let them overwrite each
+        // other's data
+        const size_t in_extent  = (length - 1) * in_stride + 1;
+        const size_t out_extent = (length - 1) * out_stride + 1;
+
+        // extend the run while offsets keep the same spacing, and the
+        // problems do not overlap
+        size_t in_distance  = 0;
+        size_t out_distance = 0;
+        size_t end          = start + 1;
+        for(; end < num_problems; ++end)
+        {
+            size_t next_length, next_in_stride, next_out_stride, next_in_offset, next_out_offset;
+            std::tie(next_length, next_in_stride, next_out_stride, next_in_offset, next_out_offset)
+                = problem(order[end]);
+            if(next_length != length || next_in_stride != in_stride
+               || next_out_stride != out_stride)
+                break;
+
+            size_t prev_in_offset  = std::get<3>(problem(order[end - 1]));
+            size_t prev_out_offset = std::get<4>(problem(order[end - 1]));
+            if(next_in_offset < prev_in_offset + in_extent
+               || next_out_offset < prev_out_offset + out_extent)
+                break;
+            if(end == start + 1)
+            {
+                in_distance  = next_in_offset - prev_in_offset;
+                out_distance = next_out_offset - prev_out_offset;
+            }
+            else if(next_in_offset - prev_in_offset != in_distance
+                    || next_out_offset - prev_out_offset != out_distance)
+                break;
+        }
+
+        rocfft_plan   run_plan = nullptr;
+        rocfft_status ret      = CreateRunPlan(&run_plan,
+                                               placement,
+                                               transform_type,
+                                               precision,
+                                               length,
+                                               end - start,
+                                               in_stride,
+                                               in_distance,
+                                               out_stride,
+                                               out_distance);
+        if(ret != rocfft_status_success)
+        {
+            rocfft_grouped_plan_destroy(p);
+            return ret;
+        }
+        p->plans.push_back(run_plan);
+        p->inOffsets.push_back(in_offset);
+        p->outOffsets.push_back(out_offset);
+
+        start = end;
+    }
+
+    *plan = p;
+    log_trace(__func__, "grouped_plan", *plan, "runs", p->plans.size());
+    return rocfft_status_success;
+}
+
+rocfft_status rocfft_grouped_plan_get_work_buffer_size(const rocfft_grouped_plan plan,
+                                                       size_t*                   size_in_bytes)
+{
+    log_trace(__func__, "plan", plan, "size_in_bytes", size_in_bytes);
+    if(!plan || !size_in_bytes)
+        return rocfft_status_invalid_arg_value;
+
+    // runs execute one after another, so they can share a work buffer
+    *size_in_bytes = 0;
+    for(auto run_plan : plan->plans)
+    {
+        size_t run_size = 0;
+        rocfft_plan_get_work_buffer_size(run_plan, &run_size);
+        *size_in_bytes = std::max(*size_in_bytes, run_size);
+    }
+    return rocfft_status_success;
+}
+
+rocfft_status rocfft_execute_grouped(const rocfft_grouped_plan plan,
+                                     void*                     in_buffer[],
+                                     void*                     out_buffer[],
+                                     rocfft_execution_info     info)
+{
+    log_trace(
+        __func__, "plan", plan, "in_buffer", in_buffer, "out_buffer", out_buffer, "info", info);
+    if(!plan || !in_buffer)
+        return rocfft_status_invalid_arg_value;
+    if(plan->placement == rocfft_placement_notinplace && !out_buffer)
+        return rocfft_status_invalid_arg_value;
+
+    // point each run's buffers at its first problem
+    size_t              runs = plan->plans.size();
+    std::vector<void*>  buffers(2 * runs);
+    std::vector<void**> in_buffers(runs);
+    std::vector<void**> out_buffers(runs);
+    for(size_t i = 0; i < runs; ++i)
+    {
+        buffers[2 * i] = static_cast<char*>(in_buffer[0]) + plan->inOffsets[i] * plan->elemSize;
+        in_buffers[i]  = &buffers[2 * i];
+        if(plan->placement == rocfft_placement_notinplace)
+        {
+            buffers[2 * i + 1]
+                = static_cast<char*>(out_buffer[0]) + plan->outOffsets[i] * plan->elemSize;
+            out_buffers[i] = &buffers[2 * i + 1];
+        }
+    }
+
+    return ExecutePlans(plan->plans.data(), runs, in_buffers.data(), out_buffers.data(), info);
+}
+
+rocfft_status rocfft_grouped_plan_destroy(rocfft_grouped_plan plan)
+{
+    log_trace(__func__, "plan", plan);
+    if(plan != nullptr)
+    {
+        for(auto run_plan : plan->plans)
+            rocfft_plan_destroy(run_plan);
+        delete plan;
+    }
+    return rocfft_status_success;
+}
@@ -67,7 +67,7 @@ struct hipfftHandle_t
     rocfft_plan           ip_inverse;
     rocfft_plan           op_inverse;
     rocfft_execution_info info;
-    void*                 workBuffer;
+    size_t                workBufferSize;
     bool                  autoAllocate;
 
     hipfftHandle_t()
@@ -76,7 +76,7 @@ struct hipfftHandle_t
         , ip_inverse(nullptr)
         , op_inverse(nullptr)
         , info(nullptr)
-        , workBuffer(nullptr)
+        , workBufferSize(0)
         , autoAllocate(true)
     {
     }
@@ -330,19 +330,11 @@ hipfftResult hipfftMakePlan_internal(hipfftHandle            plan,
         workBufferSize = std::max(workBufferSize, tmpBufferSize);
     }
 
-    if(workBufferSize > 0)
-    {
-        if(plan->autoAllocate)
-        {
-            if(plan->workBuffer)
-                if(hipFree(plan->workBuffer) != hipSuccess)
-                    return HIPFFT_ALLOC_FAILED;
-            if(hipMalloc(&plan->workBuffer, workBufferSize) != hipSuccess)
-                return HIPFFT_ALLOC_FAILED;
-        }
-        ROC_FFT_CHECK_INVALID_VALUE(
-            rocfft_execution_info_set_work_buffer(plan->info, plan->workBuffer, workBufferSize));
-    }
+    // automatically allocated work buffers come from the library's
+    // pool, so that handles executing on the same stream share them
+    plan->workBufferSize = workBufferSize;
+    ROC_FFT_CHECK_INVALID_VALUE(
+        rocfft_execution_info_set_work_buffer_pool(plan->info, plan->autoAllocate));
 
     if(workSize != nullptr)
         *workSize = workBufferSize;
@@ -764,7 +756,7 @@ hipfftResult hipfftGetSize(hipfftHandle plan, size_t* workSize)
 {
     // return hipfftGetSize_internal(plan, type, workArea);
 
-    *workSize = plan->info->workBufferSize;
+    *workSize = plan->workBufferSize;
     return HIPFFT_SUCCESS;
 }
 
@@ -789,7 +781,7 @@ hipfftResult hipfftGetSizeMany64(hipfftHandle   plan,
 hipfftResult hipfftSetWorkArea(hipfftHandle plan, void* workArea)
 {
     ROC_FFT_CHECK_INVALID_VALUE(
-        rocfft_execution_info_set_work_buffer(plan->info, workArea, plan->info->workBufferSize));
+        rocfft_execution_info_set_work_buffer(plan->info, workArea, plan->workBufferSize));
     return HIPFFT_SUCCESS;
 }
 
@@ -798,6 +790,7 @@ hipfftResult hipfftSetAutoAllocation(hipfftHandle plan, int autoAllocate)
     if(plan != nullptr && autoAllocate == 0)
     {
         plan->autoAllocate = false;
+        ROC_FFT_CHECK_INVALID_VALUE(rocfft_execution_info_set_work_buffer_pool(plan->info, 0));
     }
     return HIPFFT_SUCCESS;
 }
@@ -970,9 +963,6 @@ hipfftResult hipfftDestroy(hipfftHandle plan)
         ROC_FFT_CHECK_INVALID_VALUE(rocfft_plan_destroy(plan->ip_inverse));
         ROC_FFT_CHECK_INVALID_VALUE(rocfft_plan_destroy(plan->op_inverse));
 
-        if(plan->autoAllocate)
-            hipFree(plan->workBuffer);
-
         ROC_FFT_CHECK_INVALID_VALUE(rocfft_execution_info_destroy(plan->info));
 
         delete plan;
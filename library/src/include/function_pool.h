@@ -49,6 +49,26 @@ struct SimpleHash
     // = &rocfft_internal_dfn_sp_ci_ci_stoc_1_64;
 };
 
+// Launch parameters of a generated kernel.  The kernel generator
+// writes these next to each function pointer (and to
+// rocfft_kernel_metadata.json), so plans don't need separate tables
+// that have to be kept in sync with the generator.
+struct KernelMetadata
+{
+    // radices of each pass; 2D kernels list the row transform's
+    // radices followed by the column transform's
+    std::vector<size_t> radices;
+    // threads per block, and transforms per block (the block width
+    // for SBCC/SBRC kernels)
+    size_t workGroupSize = 0;
+    size_t transforms    = 0;
+    size_t ldsBytes      = 0;
+    // estimated 32-bit registers per thread for the elements it holds
+    size_t registers = 0;
+    // whether the fastest dimension may have a non-unit stride
+    bool nonUnitStride = false;
+};
+
 class function_pool
 {
     using Key   = std::pair<size_t, ComputeScheme>;
@@ -59,6 +79,16 @@ class function_pool
     std::unordered_map<Key2D, DevFnCall, SimpleHash> function_map_single_2D;
     std::unordered_map<Key2D, DevFnCall, SimpleHash> function_map_double_2D;
 
+    // variants of the Stockham kernels that read their input and
+    // write their output through user callbacks
+    std::unordered_map<Key, DevFnCall, SimpleHash> callback_map_single;
+    std::unordered_map<Key, DevFnCall, SimpleHash> callback_map_double;
+
+    std::unordered_map<Key, KernelMetadata, SimpleHash>   metadata_map_single;
+    std::unordered_map<Key, KernelMetadata, SimpleHash>   metadata_map_double;
+    std::unordered_map<Key2D, KernelMetadata, SimpleHash> metadata_map_single_2D;
+    std::unordered_map<Key2D, KernelMetadata, SimpleHash> metadata_map_double_2D;
+
     function_pool();
 
 public:
@@ -101,6 +131,50 @@ public:
         return func_pool.function_map_double_2D.at(mykey);
     }
 
+    // The generator can be limited to a subset of sizes, so plans
+    // check whether a kernel was built before choosing it.
+    static bool has_function(rocfft_precision precision, Key mykey)
+    {
+        function_pool& func_pool = get_function_pool();
+        return precision == rocfft_precision_single ? func_pool.function_map_single.count(mykey)
+                                                    : func_pool.function_map_double.count(mykey);
+    }
+
+    static bool has_function_2D(rocfft_precision precision, Key2D mykey)
+    {
+        function_pool& func_pool = get_function_pool();
+        return precision == rocfft_precision_single
+                   ? func_pool.function_map_single_2D.count(mykey)
+                   : func_pool.function_map_double_2D.count(mykey);
+    }
+
+    // Callback variant of a kernel, or null if it has none
+    static DevFnCall get_callback_function(rocfft_precision precision, Key mykey)
+    {
+        function_pool& func_pool = get_function_pool();
+        auto&          map       = precision == rocfft_precision_single
+                                       ? func_pool.callback_map_single
+                                       : func_pool.callback_map_double;
+        auto           it        = map.find(mykey);
+        return it == map.end() ? nullptr : it->second;
+    }
+
+    // Metadata of a kernel in the pool; throws if the kernel was not
+    // generated, like the get_function calls.
+    static const KernelMetadata& get_metadata(rocfft_precision precision, Key mykey)
+    {
+        function_pool& func_pool = get_function_pool();
+        return precision == rocfft_precision_single ? func_pool.metadata_map_single.at(mykey)
+                                                    : func_pool.metadata_map_double.at(mykey);
+    }
+
+    static const KernelMetadata& get_metadata_2D(rocfft_precision precision, Key2D mykey)
+    {
+        function_pool& func_pool = get_function_pool();
+        return precision == rocfft_precision_single ? func_pool.metadata_map_single_2D.at(mykey)
+                                                    : func_pool.metadata_map_double_2D.at(mykey);
+    }
+
     static void verify_no_null_functions()
     {
         function_pool& func_pool = get_function_pool();
@@ -0,0 +1,50 @@
+/******************************************************************************
+* Copyright (c) 2016 - present Advanced Micro Devices, Inc. All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*******************************************************************************/
+
+#ifndef GROUPED_PLAN_H
+#define GROUPED_PLAN_H
+
+#include <vector>
+
+#include "rocfft.h"
+
+// A set of independent 1D complex transforms of different lengths,
+// offsets and strides.
+//
+// Problems with the same length and strides whose offsets are evenly
+// spaced are collected into runs, and each run is a single batched
+// plan, so the whole set executes with one launch per run.
+struct rocfft_grouped_plan_t
+{
+    rocfft_result_placement placement = rocfft_placement_inplace;
+
+    // size of one complex element, in bytes
+    size_t elemSize = 0;
+
+    // one plan per run, with the offsets (in elements) of the first
+    // problem in the run
+    std::vector<rocfft_plan> plans;
+    std::vector<size_t>      inOffsets;
+    std::vector<size_t>      outOffsets;
+};
+
+#endif // GROUPED_PLAN_H
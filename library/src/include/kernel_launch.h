@@ -41,8 +41,9 @@ struct DeviceCallIn
     void*     bufIn[2];
     void*     bufOut[2];
 
-    hipStream_t rocfft_stream;
-    GridParam   gridParam;
+    hipStream_t   rocfft_stream;
+    GridParam     gridParam;
+    UserCallbacks callbacks;
 };
 
 // FIXME: documentation
@@ -51,6 +52,19 @@ struct DeviceCallOut
     int err;
 };
 
+// Device arrays of per-batch buffer pointers, given in place of the
+// first input/output buffer by plans created with batch pointers.
+// Null otherwise, in which case kernels compute the batch offsets.
+static inline void* const* BatchPointersIn(const DeviceCallIn* data)
+{
+    return data->node->batchPointers ? static_cast<void* const*>(data->bufIn[0]) : nullptr;
+}
+
+static inline void* const* BatchPointersOut(const DeviceCallIn* data)
+{
+    return data->node->batchPointers ? static_cast<void* const*>(data->bufOut[0]) : nullptr;
+}
+
 extern "C" {
 
 /* Naming convention
@@ -69,6 +83,7 @@ ci – complex-interleaved (format of input buffer)
 ci – complex-interleaved (format of output buffer)
 
 stoc – stockham fft kernel
+real – real-to-complex or complex-to-real, depending on direction
 bcc - block column column
 
 1(2) – one (two) dimension data from kernel viewpoint, but 2D may transform into
@@ -130,6 +145,7 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                                            data->node->devKernArg.data()                           \
                                                + 1 * KERN_ARGS_ARRAY_WIDTH,                        \
                                            data->node->batch,                                      \
+                                           BatchPointersIn(data),                                  \
                                            (PRECISION*)data->bufIn[0]);                            \
                     }                                                                              \
                     else if((data->node->inArrayType == rocfft_array_type_complex_planar           \
@@ -149,6 +165,7 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                                            data->node->devKernArg.data()                           \
                                                + 1 * KERN_ARGS_ARRAY_WIDTH,                        \
                                            data->node->batch,                                      \
+                                           BatchPointersIn(data),                                  \
                                            (real_type_t<PRECISION>*)data->bufIn[0],                \
                                            (real_type_t<PRECISION>*)data->bufIn[1]);               \
                     }                                                                              \
@@ -172,6 +189,7 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                                            data->node->devKernArg.data()                           \
                                                + 1 * KERN_ARGS_ARRAY_WIDTH,                        \
                                            data->node->batch,                                      \
+                                           BatchPointersIn(data),                                  \
                                            (PRECISION*)data->bufIn[0]);                            \
                     }                                                                              \
                     else if((data->node->inArrayType == rocfft_array_type_complex_planar           \
@@ -191,6 +209,7 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                                            data->node->devKernArg.data()                           \
                                                + 1 * KERN_ARGS_ARRAY_WIDTH,                        \
                                            data->node->batch,                                      \
+                                           BatchPointersIn(data),                                  \
                                            (real_type_t<PRECISION>*)data->bufIn[0],                \
                                            (real_type_t<PRECISION>*)data->bufIn[1]);               \
                     }                                                                              \
@@ -217,6 +236,7 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             data->node->devKernArg.data(),                                         \
                             data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,             \
                             data->node->batch,                                                     \
+                            BatchPointersIn(data),                                                 \
                             (PRECISION*)data->bufIn[0]);                                           \
                     }                                                                              \
                     else if((data->node->inArrayType == rocfft_array_type_complex_planar           \
@@ -236,6 +256,7 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             data->node->devKernArg.data(),                                         \
                             data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,             \
                             data->node->batch,                                                     \
+                            BatchPointersIn(data),                                                 \
                             (real_type_t<PRECISION>*)data->bufIn[0],                               \
                             (real_type_t<PRECISION>*)data->bufIn[1]);                              \
                     }                                                                              \
@@ -259,6 +280,7 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             data->node->devKernArg.data(),                                         \
                             data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,             \
                             data->node->batch,                                                     \
+                            BatchPointersIn(data),                                                 \
                             (PRECISION*)data->bufIn[0]);                                           \
                     }                                                                              \
                     else if((data->node->inArrayType == rocfft_array_type_complex_planar           \
@@ -278,6 +300,7 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             data->node->devKernArg.data(),                                         \
                             data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,             \
                             data->node->batch,                                                     \
+                            BatchPointersIn(data),                                                 \
                             (real_type_t<PRECISION>*)data->bufIn[0],                               \
                             (real_type_t<PRECISION>*)data->bufIn[1]);                              \
                     }                                                                              \
@@ -308,6 +331,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,             \
                             data->node->devKernArg.data() + 2 * KERN_ARGS_ARRAY_WIDTH,             \
                             data->node->batch,                                                     \
+                            BatchPointersIn(data),                                                 \
+                            BatchPointersOut(data),                                                \
                             (PRECISION*)data->bufIn[0],                                            \
                             (PRECISION*)data->bufOut[0]);                                          \
                     }                                                                              \
@@ -330,6 +355,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,             \
                             data->node->devKernArg.data() + 2 * KERN_ARGS_ARRAY_WIDTH,             \
                             data->node->batch,                                                     \
+                            BatchPointersIn(data),                                                 \
+                            BatchPointersOut(data),                                                \
                             (PRECISION*)data->bufIn[0],                                            \
                             (real_type_t<PRECISION>*)data->bufOut[0],                              \
                             (real_type_t<PRECISION>*)data->bufOut[1]);                             \
@@ -352,6 +379,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,             \
                             data->node->devKernArg.data() + 2 * KERN_ARGS_ARRAY_WIDTH,             \
                             data->node->batch,                                                     \
+                            BatchPointersIn(data),                                                 \
+                            BatchPointersOut(data),                                                \
                             (real_type_t<PRECISION>*)data->bufIn[0],                               \
                             (real_type_t<PRECISION>*)data->bufIn[1],                               \
                             (PRECISION*)data->bufOut[0]);                                          \
@@ -374,6 +403,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,             \
                             data->node->devKernArg.data() + 2 * KERN_ARGS_ARRAY_WIDTH,             \
                             data->node->batch,                                                     \
+                            BatchPointersIn(data),                                                 \
+                            BatchPointersOut(data),                                                \
                             (real_type_t<PRECISION>*)data->bufIn[0],                               \
                             (real_type_t<PRECISION>*)data->bufIn[1],                               \
                             (real_type_t<PRECISION>*)data->bufOut[0],                              \
@@ -400,6 +431,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,             \
                             data->node->devKernArg.data() + 2 * KERN_ARGS_ARRAY_WIDTH,             \
                             data->node->batch,                                                     \
+                            BatchPointersIn(data),                                                 \
+                            BatchPointersOut(data),                                                \
                             (PRECISION*)data->bufIn[0],                                            \
                             (PRECISION*)data->bufOut[0]);                                          \
                     }                                                                              \
@@ -422,6 +455,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,             \
                             data->node->devKernArg.data() + 2 * KERN_ARGS_ARRAY_WIDTH,             \
                             data->node->batch,                                                     \
+                            BatchPointersIn(data),                                                 \
+                            BatchPointersOut(data),                                                \
                             (PRECISION*)data->bufIn[0],                                            \
                             (real_type_t<PRECISION>*)data->bufOut[0],                              \
                             (real_type_t<PRECISION>*)data->bufOut[1]);                             \
@@ -444,6 +479,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,             \
                             data->node->devKernArg.data() + 2 * KERN_ARGS_ARRAY_WIDTH,             \
                             data->node->batch,                                                     \
+                            BatchPointersIn(data),                                                 \
+                            BatchPointersOut(data),                                                \
                             (real_type_t<PRECISION>*)data->bufIn[0],                               \
                             (real_type_t<PRECISION>*)data->bufIn[1],                               \
                             (PRECISION*)data->bufOut[0]);                                          \
@@ -466,6 +503,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,             \
                             data->node->devKernArg.data() + 2 * KERN_ARGS_ARRAY_WIDTH,             \
                             data->node->batch,                                                     \
+                            BatchPointersIn(data),                                                 \
+                            BatchPointersOut(data),                                                \
                             (real_type_t<PRECISION>*)data->bufIn[0],                               \
                             (real_type_t<PRECISION>*)data->bufIn[1],                               \
                             (real_type_t<PRECISION>*)data->bufOut[0],                              \
@@ -495,6 +534,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,             \
                             data->node->devKernArg.data() + 2 * KERN_ARGS_ARRAY_WIDTH,             \
                             data->node->batch,                                                     \
+                            BatchPointersIn(data),                                                 \
+                            BatchPointersOut(data),                                                \
                             (PRECISION*)data->bufIn[0],                                            \
                             (PRECISION*)data->bufOut[0]);                                          \
                     }                                                                              \
@@ -517,6 +558,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,             \
                             data->node->devKernArg.data() + 2 * KERN_ARGS_ARRAY_WIDTH,             \
                             data->node->batch,                                                     \
+                            BatchPointersIn(data),                                                 \
+                            BatchPointersOut(data),                                                \
                             (PRECISION*)data->bufIn[0],                                            \
                             (real_type_t<PRECISION>*)data->bufOut[0],                              \
                             (real_type_t<PRECISION>*)data->bufOut[1]);                             \
@@ -539,6 +582,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,             \
                             data->node->devKernArg.data() + 2 * KERN_ARGS_ARRAY_WIDTH,             \
                             data->node->batch,                                                     \
+                            BatchPointersIn(data),                                                 \
+                            BatchPointersOut(data),                                                \
                             (real_type_t<PRECISION>*)data->bufIn[0],                               \
                             (real_type_t<PRECISION>*)data->bufIn[1],                               \
                             (PRECISION*)data->bufOut[0]);                                          \
@@ -561,6 +606,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,             \
                             data->node->devKernArg.data() + 2 * KERN_ARGS_ARRAY_WIDTH,             \
                             data->node->batch,                                                     \
+                            BatchPointersIn(data),                                                 \
+                            BatchPointersOut(data),                                                \
                             (real_type_t<PRECISION>*)data->bufIn[0],                               \
                             (real_type_t<PRECISION>*)data->bufIn[1],                               \
                             (real_type_t<PRECISION>*)data->bufOut[0],                              \
@@ -587,6 +634,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,             \
                             data->node->devKernArg.data() + 2 * KERN_ARGS_ARRAY_WIDTH,             \
                             data->node->batch,                                                     \
+                            BatchPointersIn(data),                                                 \
+                            BatchPointersOut(data),                                                \
                             (PRECISION*)data->bufIn[0],                                            \
                             (PRECISION*)data->bufOut[0]);                                          \
                     }                                                                              \
@@ -609,6 +658,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,             \
                             data->node->devKernArg.data() + 2 * KERN_ARGS_ARRAY_WIDTH,             \
                             data->node->batch,                                                     \
+                            BatchPointersIn(data),                                                 \
+                            BatchPointersOut(data),                                                \
                             (PRECISION*)data->bufIn[0],                                            \
                             (real_type_t<PRECISION>*)data->bufOut[0],                              \
                             (real_type_t<PRECISION>*)data->bufOut[1]);                             \
@@ -631,6 +682,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,             \
                             data->node->devKernArg.data() + 2 * KERN_ARGS_ARRAY_WIDTH,             \
                             data->node->batch,                                                     \
+                            BatchPointersIn(data),                                                 \
+                            BatchPointersOut(data),                                                \
                             (real_type_t<PRECISION>*)data->bufIn[0],                               \
                             (real_type_t<PRECISION>*)data->bufIn[1],                               \
                             (PRECISION*)data->bufOut[0]);                                          \
@@ -653,6 +706,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,             \
                             data->node->devKernArg.data() + 2 * KERN_ARGS_ARRAY_WIDTH,             \
                             data->node->batch,                                                     \
+                            BatchPointersIn(data),                                                 \
+                            BatchPointersOut(data),                                                \
                             (real_type_t<PRECISION>*)data->bufIn[0],                               \
                             (real_type_t<PRECISION>*)data->bufIn[1],                               \
                             (real_type_t<PRECISION>*)data->bufOut[0],                              \
@@ -663,6 +718,70 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
         }                                                                                          \
     }
 
+/*
+   Stockham kernels that read their input and write their output
+   through the plan's user callbacks.  Only complex interleaved data
+   is supported, without per-batch pointers.
+ */
+
+#define POWX_SMALL_CALLBACK_GENERATOR(FUNCTION_NAME,                                      \
+                                      IP_FWD_KERN_NAME,                                   \
+                                      IP_BACK_KERN_NAME,                                  \
+                                      OP_FWD_KERN_NAME,                                   \
+                                      OP_BACK_KERN_NAME,                                  \
+                                      PRECISION)                                          \
+    void FUNCTION_NAME(const void* data_p, void* back_p)                                  \
+    {                                                                                     \
+        DeviceCallIn* data          = (DeviceCallIn*)data_p;                              \
+        hipStream_t   rocfft_stream = data->rocfft_stream;                                \
+        UserCallbacks cb            = data->callbacks;                                    \
+        cb.in_base                  = data->bufIn[0];                                     \
+        cb.out_base                 = data->bufOut[0];                                    \
+                                                                                          \
+        bool fwd  = data->node->direction == -1;                                          \
+        bool unit = data->node->inStride[0] == 1 && data->node->outStride[0] == 1;        \
+        if(data->node->placement == rocfft_placement_inplace)                             \
+        {                                                                                 \
+            auto kernel = fwd ? (unit ? &IP_FWD_KERN_NAME<PRECISION, SB_UNIT>             \
+                                      : &IP_FWD_KERN_NAME<PRECISION, SB_NONUNIT>)         \
+                              : (unit ? &IP_BACK_KERN_NAME<PRECISION, SB_UNIT>            \
+                                      : &IP_BACK_KERN_NAME<PRECISION, SB_NONUNIT>);       \
+            hipLaunchKernelGGL(kernel,                                                    \
+                               dim3(data->gridParam.b_x),                                 \
+                               dim3(data->gridParam.tpb_x),                               \
+                               0,                                                         \
+                               rocfft_stream,                                             \
+                               (PRECISION*)data->node->twiddles.data(),                   \
+                               data->node->length.size(),                                 \
+                               data->node->devKernArg.data(),                             \
+                               data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH, \
+                               data->node->batch,                                         \
+                               cb,                                                        \
+                               (PRECISION*)data->bufIn[0]);                               \
+        }                                                                                 \
+        else                                                                              \
+        {                                                                                 \
+            auto kernel = fwd ? (unit ? &OP_FWD_KERN_NAME<PRECISION, SB_UNIT>             \
+                                      : &OP_FWD_KERN_NAME<PRECISION, SB_NONUNIT>)         \
+                              : (unit ? &OP_BACK_KERN_NAME<PRECISION, SB_UNIT>            \
+                                      : &OP_BACK_KERN_NAME<PRECISION, SB_NONUNIT>);       \
+            hipLaunchKernelGGL(kernel,                                                    \
+                               dim3(data->gridParam.b_x),                                 \
+                               dim3(data->gridParam.tpb_x),                               \
+                               0,                                                         \
+                               rocfft_stream,                                             \
+                               (PRECISION*)data->node->twiddles.data(),                   \
+                               data->node->length.size(),                                 \
+                               data->node->devKernArg.data(),                             \
+                               data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH, \
+                               data->node->devKernArg.data() + 2 * KERN_ARGS_ARRAY_WIDTH, \
+                               data->node->batch,                                         \
+                               cb,                                                        \
+                               (PRECISION*)data->bufIn[0],                                \
+                               (PRECISION*)data->bufOut[0]);                              \
+        }                                                                                 \
+    }
+
 #define POWX_LARGE_SBCC_GENERATOR(FUNCTION_NAME,                                                \
                                   IP_FWD_KERN_NAME,                                             \
                                   IP_BACK_KERN_NAME,                                            \
@@ -1390,4 +1509,89 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
         }                                                                                        \
     }
 
+/*
+   Fused single-kernel real transforms for odd lengths: forward is
+   real-to-hermitian, backward is hermitian-to-real.  The same kernels
+   serve in-place and out-of-place transforms.
+ */
+
+#define POWX_REAL_SMALL_GENERATOR(FUNCTION_NAME, FWD_KERN_NAME, BACK_KERN_NAME, PRECISION)       \
+    void FUNCTION_NAME(const void* data_p, void* back_p)                                         \
+    {                                                                                            \
+        DeviceCallIn* data          = (DeviceCallIn*)data_p;                                     \
+        hipStream_t   rocfft_stream = data->rocfft_stream;                                       \
+        if(data->node->direction == -1)                                                          \
+        {                                                                                        \
+            if(data->node->outArrayType == rocfft_array_type_hermitian_interleaved)              \
+            {                                                                                    \
+                hipLaunchKernelGGL(HIP_KERNEL_NAME(FWD_KERN_NAME<PRECISION, SB_UNIT>),           \
+                                   dim3(data->gridParam.b_x),                                    \
+                                   dim3(data->gridParam.tpb_x),                                  \
+                                   0,                                                            \
+                                   rocfft_stream,                                                \
+                                   (PRECISION*)data->node->twiddles.data(),                      \
+                                   data->node->length.size(),                                    \
+                                   data->node->devKernArg.data(),                                \
+                                   data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,    \
+                                   data->node->devKernArg.data() + 2 * KERN_ARGS_ARRAY_WIDTH,    \
+                                   data->node->batch,                                            \
+                                   (real_type_t<PRECISION>*)data->bufIn[0],                      \
+                                   (PRECISION*)data->bufOut[0]);                                 \
+            }                                                                                    \
+            else                                                                                 \
+            {                                                                                    \
+                hipLaunchKernelGGL(HIP_KERNEL_NAME(FWD_KERN_NAME<PRECISION, SB_UNIT>),           \
+                                   dim3(data->gridParam.b_x),                                    \
+                                   dim3(data->gridParam.tpb_x),                                  \
+                                   0,                                                            \
+                                   rocfft_stream,                                                \
+                                   (PRECISION*)data->node->twiddles.data(),                      \
+                                   data->node->length.size(),                                    \
+                                   data->node->devKernArg.data(),                                \
+                                   data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,    \
+                                   data->node->devKernArg.data() + 2 * KERN_ARGS_ARRAY_WIDTH,    \
+                                   data->node->batch,                                            \
+                                   (real_type_t<PRECISION>*)data->bufIn[0],                      \
+                                   (real_type_t<PRECISION>*)data->bufOut[0],                     \
+                                   (real_type_t<PRECISION>*)data->bufOut[1]);                    \
+            }                                                                                    \
+        }                                                                                        \
+        else                                                                                     \
+        {                                                                                        \
+            if(data->node->inArrayType == rocfft_array_type_hermitian_interleaved)               \
+            {                                                                                    \
+                hipLaunchKernelGGL(HIP_KERNEL_NAME(BACK_KERN_NAME<PRECISION, SB_UNIT>),          \
+                                   dim3(data->gridParam.b_x),                                    \
+                                   dim3(data->gridParam.tpb_x),                                  \
+                                   0,                                                            \
+                                   rocfft_stream,                                                \
+                                   (PRECISION*)data->node->twiddles.data(),                      \
+                                   data->node->length.size(),                                    \
+                                   data->node->devKernArg.data(),                                \
+                                   data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,    \
+                                   data->node->devKernArg.data() + 2 * KERN_ARGS_ARRAY_WIDTH,    \
+                                   data->node->batch,                                            \
+                                   (PRECISION*)data->bufIn[0],                                   \
+                                   (real_type_t<PRECISION>*)data->bufOut[0]);                    \
+            }                                                                                    \
+            else                                                                                 \
+            {                                                                                    \
+                hipLaunchKernelGGL(HIP_KERNEL_NAME(BACK_KERN_NAME<PRECISION, SB_UNIT>),          \
+                                   dim3(data->gridParam.b_x),                                    \
+                                   dim3(data->gridParam.tpb_x),                                  \
+                                   0,                                                            \
+                                   rocfft_stream,                                                \
+                                   (PRECISION*)data->node->twiddles.data(),                      \
+                                   data->node->length.size(),                                    \
+                                   data->node->devKernArg.data(),                                \
+                                   data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,    \
+                                   data->node->devKernArg.data() + 2 * KERN_ARGS_ARRAY_WIDTH,    \
+                                   data->node->batch,                                            \
+                                   (real_type_t<PRECISION>*)data->bufIn[0],                      \
+                                   (real_type_t<PRECISION>*)data->bufIn[1],                      \
+                                   (real_type_t<PRECISION>*)data->bufOut[0]);                    \
+            }                                                                                    \
+        }                                                                                        \
+    }
+
 #endif // KERNEL_LAUNCH_SINGLE
@@ -0,0 +1,90 @@
+/******************************************************************************
+* Copyright (c) 2016 - present Advanced Micro Devices, Inc. All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*******************************************************************************/
+
+#ifndef KERNEL_PROFILER_H
+#define KERNEL_PROFILER_H
+
+#include <list>
+#include <mutex>
+#include <vector>
+
+#include "rocfft_hip.h"
+#include "tree_node.h"
+
+// Collects kernel timings for profile logging without waiting for
+// the kernels to finish.
+//
+// Timing events come from a pool and are recorded on the stream the
+// kernel runs on.  Each kernel's timing is logged once its stop event
+// has completed, which is checked on later calls to Harvest.
+class KernelProfiler
+{
+    KernelProfiler() {}
+
+public:
+    KernelProfiler(const KernelProfiler&) = delete;
+    KernelProfiler& operator=(const KernelProfiler&) = delete;
+
+    static KernelProfiler& GetProfiler()
+    {
+        static KernelProfiler profiler;
+        return profiler;
+    }
+
+    // Get a pair of events to record before and after a kernel
+    bool GetEvents(hipEvent_t& start, hipEvent_t& stop);
+
+    // Queue a kernel's events to be logged once they've completed.
+    // The events are returned to the pool after logging.
+    void Submit(hipEvent_t                 start,
+                hipEvent_t                 stop,
+                ComputeScheme              scheme,
+                const std::vector<size_t>& length,
+                size_t                     total_size_bytes,
+                float                      max_memory_bw);
+
+    // Log all queued kernels that have finished.  If wait is true,
+    // wait for all queued kernels to finish first.
+    void Harvest(bool wait);
+
+    // Log all queued kernels and release the pooled events
+    void Flush();
+
+private:
+    struct Record
+    {
+        hipEvent_t          start;
+        hipEvent_t          stop;
+        ComputeScheme       scheme;
+        std::vector<size_t> length;
+        size_t              total_size_bytes;
+        float               max_memory_bw;
+    };
+
+    void Emit(const Record& record);
+
+    std::list<Record>       pending;
+    std::vector<hipEvent_t> eventPool;
+    std::mutex              mtx;
+};
+
+#endif // KERNEL_PROFILER_H
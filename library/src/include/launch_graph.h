@@ -0,0 +1,99 @@
+/******************************************************************************
+* Copyright (c) 2016 - present Advanced Micro Devices, Inc. All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*******************************************************************************/
+
+#ifndef LAUNCH_GRAPH_H
+#define LAUNCH_GRAPH_H
+
+#include <list>
+#include <mutex>
+
+#include "rocfft_hip.h"
+
+// HIP graphs and stream capture are only usable from ROCm 4.3 onwards.
+// Older runtimes always launch plans directly.
+#if HIP_VERSION_MAJOR > 4 || (HIP_VERSION_MAJOR == 4 && HIP_VERSION_MINOR >= 3)
+#define ROCFFT_HAVE_HIP_GRAPH 1
+#endif
+
+struct ExecPlan;
+
+// Maximum number of instantiated graphs kept per plan, and of
+// uncaptured streams and buffers remembered per plan
+static const size_t LAUNCH_GRAPH_CACHE_SIZE = 8;
+
+// Per-plan cache of HIP graphs, each one recording the plan's launch
+// sequence for a particular stream and set of buffers.  Shared by
+// all copies of an ExecPlan, so the graphs are released along with
+// the plan.
+class LaunchGraphCache
+{
+public:
+    explicit LaunchGraphCache(const ExecPlan& execPlan);
+    ~LaunchGraphCache();
+
+    LaunchGraphCache(const LaunchGraphCache&) = delete;
+    LaunchGraphCache& operator=(const LaunchGraphCache&) = delete;
+
+    // Replay the graph for this stream and set of buffers.  A graph
+    // is captured the second time a stream and set of buffers is
+    // seen, so that buffers that keep changing do not pay for
+    // capture.  Returns false without launching anything if the plan
+    // must instead be launched directly.
+    bool Launch(const ExecPlan& execPlan,
+                void*           in_buffer[],
+                void*           out_buffer[],
+                void*           work_buffer,
+                hipStream_t     stream);
+
+private:
+    struct Key
+    {
+        hipStream_t stream;
+        void*       in[2];
+        void*       out[2];
+        void*       work;
+
+        bool operator==(const Key& other) const;
+    };
+
+#ifdef ROCFFT_HAVE_HIP_GRAPH
+    struct Entry
+    {
+        Key            key;
+        hipGraphExec_t graph;
+    };
+
+    // captured graphs, most recently used at the front
+    std::list<Entry> entries;
+
+    // streams and buffers that have been seen once but not captured,
+    // most recent at the front.  Kept apart from the graphs so that
+    // one-off buffers do not evict graphs that are being replayed.
+    std::list<Key> seen;
+#endif
+
+    // false if some kernel in the plan cannot be stream-captured
+    bool       capturable = false;
+    std::mutex mtx;
+};
+
+#endif // LAUNCH_GRAPH_H
@@ -28,6 +28,12 @@
 #include "function_pool.h"
 #include "tree_node.h"
 
+// Largest transform rank accepted by plan creation.  Plan nodes can
+// carry an extra length from large 1D decompositions, and the
+// distance is stored after the strides, so this must stay well below
+// KERN_ARGS_ARRAY_WIDTH.
+#define ROCFFT_MAX_RANK 8
+
 static inline bool IsPo2(size_t u)
 {
     return (u != 0) && (0 == (u & (u - 1)));
@@ -64,7 +70,12 @@ inline bool SupportedLength(rocfft_precision precision, size_t len)
         p /= 3;
     while(!(p % 5))
         p /= 5;
-    // while(!(p%7)) p /= 7;
+    while(!(p % 7))
+        p /= 7;
+    while(!(p % 11))
+        p /= 11;
+    while(!(p % 13))
+        p /= 13;
 
     if(p == 1)
         return true;
@@ -104,8 +115,8 @@ struct rocfft_plan_description_t
     rocfft_array_type inArrayType  = rocfft_array_type_complex_interleaved;
     rocfft_array_type outArrayType = rocfft_array_type_complex_interleaved;
 
-    std::array<size_t, 3> inStrides  = {0, 0, 0};
-    std::array<size_t, 3> outStrides = {0, 0, 0};
+    std::array<size_t, ROCFFT_MAX_RANK> inStrides  = {};
+    std::array<size_t, ROCFFT_MAX_RANK> outStrides = {};
 
     size_t inDist  = 0;
     size_t outDist = 0;
@@ -115,14 +126,18 @@ struct rocfft_plan_description_t
 
     double scale = 1.0;
 
+    // buffers are device arrays of per-batch pointers
+    int batchPointers = 0;
+    int padding       = 0; // it is only for 8 bytes alignment
+
     rocfft_plan_description_t() = default;
 };
 
 struct rocfft_plan_t
 {
-    size_t                rank    = 1;
-    std::array<size_t, 3> lengths = {1, 1, 1};
-    size_t                batch   = 1;
+    size_t                              rank    = 1;
+    std::array<size_t, ROCFFT_MAX_RANK> lengths = {1, 1, 1, 1, 1, 1, 1, 1};
+    size_t                              batch   = 1;
 
     rocfft_result_placement placement      = rocfft_placement_inplace;
     rocfft_transform_type   transformType  = rocfft_transform_type_complex_forward;
@@ -147,5 +162,11 @@ struct rocfft_plan_t
 };
 
 bool PlanPowX(ExecPlan& execPlan);
+// Move device twiddles and kernel arguments between the nodes of
+// two plans that only differ in batch count
+void MoveDeviceBuffers(ExecPlan& from, ExecPlan& to);
+// Apply user load/store callbacks to the first and last kernels of a
+// plan, or return an error if they don't support callbacks
+rocfft_status SetPlanCallbacks(ExecPlan& execPlan, const UserCallbacks& callbacks);
 
 #endif // PLAN_H
@@ -49,6 +49,12 @@ DLL_PUBLIC rocfft_status rocfft_plan_allocate(rocfft_plan* plan);
 DLL_PUBLIC rocfft_status rocfft_repo_get_unique_plan_count(size_t* count);
 DLL_PUBLIC rocfft_status rocfft_repo_get_total_plan_count(size_t* count);
 
+// Names of the kernel schemes a plan runs, in execution order and
+// separated by spaces, for tests that check which scheme is chosen
+DLL_PUBLIC rocfft_status rocfft_plan_get_kernel_schemes(const rocfft_plan plan,
+                                                        char*             buf,
+                                                        size_t            buf_size);
+
 #ifdef __cplusplus
 }
 #endif // __cplusplus
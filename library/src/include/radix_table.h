@@ -24,6 +24,7 @@
 #if !defined(RADIX_TABLE_H)
 #define RADIX_TABLE_H
 
+#include <algorithm>
 #include <assert.h>
 #include <functional>
 #include <iostream>
@@ -101,47 +102,157 @@ inline const std::vector<SpecRecord>& GetRecord()
     return specRecord;
 }
 
-/* blockCompute table: used for large 1D kernels of size >= 8192 */
-inline void GetBlockComputeTable(size_t N, size_t& bwd, size_t& wgs, size_t& lds)
+// Block compute kernels keep a block of columns in LDS, which must
+// fit in this many bytes in double precision
+#define BLOCK_COMPUTE_LDS_BYTES 32768
+#define MAX_BLOCK_COMPUTE_WIDTH 16
+#define MIN_BLOCK_COMPUTE_WIDTH 4
+
+/* =====================================================================
+   Block compute sizes, for the SBCC/SBRC kernels of large 1D and 2D
+   transforms.  A block is bwd columns of length N, held in LDS as
+   lds = N * bwd complex elements.
+     bwd: the widest block up to MAX_BLOCK_COMPUTE_WIDTH columns that
+          fits in BLOCK_COMPUTE_LDS_BYTES, and divides N so that
+          square decompositions N * N can use it on both sides.
+     wgs: threadsPerTransform threads do each column, as in the
+          Stockham kernel of length N, and the block transforms as
+          many columns at a time as fit in 256 threads.
+   Returns false for lengths with no block at least
+   MIN_BLOCK_COMPUTE_WIDTH columns wide and one wavefront (64
+   threads) big.
+=================================================================== */
+inline bool GetBlockComputeSizes(size_t  N,
+                                 size_t  threadsPerTransform,
+                                 size_t& bwd,
+                                 size_t& wgs,
+                                 size_t& lds)
 {
-    switch(N)
+    const size_t maxBlockElements = BLOCK_COMPUTE_LDS_BYTES / (2 * sizeof(double));
+
+    bwd = 0;
+    for(size_t width = MAX_BLOCK_COMPUTE_WIDTH; width >= MIN_BLOCK_COMPUTE_WIDTH; --width)
     {
-    case 256:
-        bwd = 8;
-        wgs = 256;
-        break;
-    case 128:
-        bwd = 8;
-        wgs = 128;
-        break;
-    case 64:
-        bwd = 16;
-        wgs = 128;
-        break;
-    case 32:
-        bwd = 32;
-        wgs = 64;
-        break;
-    case 16:
-        bwd = 64;
-        wgs = 64;
-        break;
-    case 8:
-        bwd = 128;
-        wgs = 64;
-        break;
-    case 81:
-        bwd = 9;
-        wgs = 81;
-        break;
-    case 100:
-        bwd = 5;
-        wgs = 50;
-        break;
-    default:
-        assert(0); // should not happen
+        if(N % width == 0 && N * width <= maxBlockElements)
+        {
+            bwd = width;
+            break;
+        }
+    }
+    if(bwd == 0)
+        return false;
+
+    // columns transformed at a time must divide the block, and the
+    // threads must cover whole rows of the block when loading it
+    wgs = 0;
+    for(size_t columns = bwd; columns >= 1; --columns)
+    {
+        const size_t threads = threadsPerTransform * columns;
+        if(bwd % columns == 0 && threads <= 256 && threads % bwd == 0)
+        {
+            wgs = threads;
+            break;
+        }
     }
+    if(wgs < 64)
+        return false;
+
     lds = N * bwd;
+    return true;
+}
+
+// Split a length into passes, biggest radix first, given the number
+// of elements each work item holds.  cRad must be in descending order
+// and end with 1.
+template <size_t N>
+inline std::vector<size_t> DecomposeRadices(size_t length, size_t cnPerWI, const size_t (&cRad)[N])
+{
+    std::vector<size_t> radices;
+    size_t              R = length;
+
+    while(true)
+    {
+        size_t rad;
+
+        for(size_t r = 0; r < N; r++)
+        {
+            rad = cRad[r];
+            if((rad > cnPerWI) || (cnPerWI % rad))
+                continue;
+
+            if(!(R % rad)) // if not a multiple of rad, then exit
+                break;
+        }
+
+        assert((cnPerWI % rad) == 0);
+
+        R /= rad;
+        radices.push_back(rad);
+
+        assert(R >= 1);
+        if(R == 1)
+            break;
+    }
+
+    return radices;
+}
+
+static const size_t cRadNarrow[] = {13, 11, 10, 8, 7, 6, 5, 4, 3, 2, 1};
+static const size_t cRadWide[]   = {16, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1};
+
+// Radices of a length that is not in the spec table.  The radix-9, 12
+// and 16 butterflies are only used when they take fewer passes, so
+// lengths that gain nothing from them keep their existing kernels.
+inline std::vector<size_t> DetermineRadices(size_t length, size_t cnPerWI)
+{
+    std::vector<size_t> radices     = DecomposeRadices(length, cnPerWI, cRadNarrow);
+    std::vector<size_t> radicesWide = DecomposeRadices(length, cnPerWI, cRadWide);
+
+    return radicesWide.size() < radices.size() ? radicesWide : radices;
+}
+
+// Elements per work item to use for a length whose sizes give cnPerWI.
+// A work item does whole butterflies, so a radix-9, 12 or 16 pass may
+// need more elements per work item than the length was sized for.
+// Searches multiples of the length's prime factors up to twice cnPerWI
+// (or 16, the largest radix) for the smallest one where those radices
+// take fewer passes than cnPerWI does now, without leaving too few
+// threads per transform for the length's block compute kernels.
+// Returns cnPerWI if there is none.
+inline size_t DetermineWideNumPerWI(size_t length, size_t cnPerWI)
+{
+    size_t     bwd, blockWGS, lds;
+    const bool hasBlock = GetBlockComputeSizes(length, length / cnPerWI, bwd, blockWGS, lds);
+
+    // every prime factor of the length must divide the elements per
+    // work item, so step through multiples of their product
+    size_t step = 1;
+    for(size_t prime : {2, 3, 5, 7, 11, 13})
+    {
+        if(length % prime == 0)
+            step *= prime;
+    }
+    assert(cnPerWI % step == 0);
+
+    const size_t maxPerWI   = std::max<size_t>(2 * cnPerWI, 16);
+    size_t       bestPerWI  = cnPerWI;
+    size_t       bestPasses = DetermineRadices(length, cnPerWI).size();
+    for(size_t perWI = cnPerWI + step; perWI <= maxPerWI && perWI <= length; perWI += step)
+    {
+        if(length % perWI != 0)
+            continue;
+        if(hasBlock && !GetBlockComputeSizes(length, length / perWI, bwd, blockWGS, lds))
+            continue;
+        // only the wide butterflies are a reason to grow the work items
+        const size_t passes     = DecomposeRadices(length, perWI, cRadNarrow).size();
+        const size_t passesWide = DecomposeRadices(length, perWI, cRadWide).size();
+        if(passesWide < passes && passesWide < bestPasses)
+        {
+            bestPerWI  = perWI;
+            bestPasses = passesWide;
+        }
+    }
+    return bestPerWI;
 }
 
 /* =====================================================================
@@ -323,8 +434,16 @@ inline void DetermineSizes(const size_t& length, size_t& workGroupSize, size_t&
         }
         else
         {
-            leastNumPerWI    = 210;
-            maxWorkGroupSize = 12;
+            // other mixes of radices: each work item needs at least
+            // one butterfly of every prime radix, and the more that
+            // takes, the fewer work items there are to share a group
+            leastNumPerWI = 1;
+            for(const auto& factor : primeFactorsExpanded)
+            {
+                if(factor.second > 1)
+                    leastNumPerWI *= factor.first;
+            }
+            maxWorkGroupSize = std::max<size_t>(12, 2520 / leastNumPerWI);
         }
 
         if(maxWorkGroupSize > MAX_WORK_GROUP_SIZE)
@@ -348,6 +467,13 @@ inline void DetermineSizes(const size_t& length, size_t& workGroupSize, size_t&
         workGroupSize = numTrans * (length / leastNumPerWI);
     }
 
+    // Give each work item more elements if that saves passes.  The
+    // threadblock keeps its transforms, and so its LDS use, and loses
+    // the threads it no longer needs.
+    const size_t cnPerWI   = (numTrans * length) / workGroupSize;
+    const size_t widePerWI = DetermineWideNumPerWI(length, cnPerWI);
+    workGroupSize          = numTrans * (length / widePerWI);
+
     assert(workGroupSize <= MAX_WORK_GROUP_SIZE);
 }
 
@@ -500,4 +626,59 @@ static std::vector<std::pair<size_t, size_t>>
     return retval;
 }
 
+// Get the number of threads required for a real 2D_SINGLE kernel.
+// length0 is the real length of the fastest dimension, which is
+// transformed as a half-length complex transform on each row.  The
+// column transforms run over the length0 / 2 + 1 hermitian columns.
+inline size_t
+    Get2DSingleRealThreadCount(size_t                                        length0,
+                               size_t                                        length1,
+                               std::function<void(size_t, size_t&, size_t&)> _GetWGSAndNT)
+{
+    const size_t halfLength0 = length0 / 2;
+    size_t       workGroupSize0;
+    size_t       numTransforms0;
+    _GetWGSAndNT(halfLength0, workGroupSize0, numTransforms0);
+    size_t workGroupSize1;
+    size_t numTransforms1;
+    _GetWGSAndNT(length1, workGroupSize1, numTransforms1);
+
+    size_t numThreads0 = length1 * (workGroupSize0 / numTransforms0);
+    size_t numThreads1 = (halfLength0 + 1) * (workGroupSize1 / numTransforms1);
+    return std::max(numThreads0, numThreads1);
+}
+
+// Available sizes for real 2D single kernels, for a given size of
+// LDS.  Each real size (length0, length1) is built from a complex
+// 2D_SINGLE size (length0 / 2, length1), so that the kernels can
+// reuse the complex device functions.  The hermitian data needs one
+// more column than the complex transform.
+inline std::vector<std::pair<size_t, size_t>>
+    Single2DRealSizes(size_t                                        ldsSizeBytes,
+                      rocfft_precision                              precision,
+                      std::function<void(size_t, size_t&, size_t&)> _GetWGSAndNT)
+{
+    std::vector<std::pair<size_t, size_t>> retval;
+    static const size_t                    MAX_LDS_SIZE_BYTES = 64 * 1024;
+    if(ldsSizeBytes == 0)
+        ldsSizeBytes = MAX_LDS_SIZE_BYTES;
+    else
+        ldsSizeBytes = std::min(ldsSizeBytes, MAX_LDS_SIZE_BYTES);
+
+    size_t realSizeBytes = precision == rocfft_precision_single ? sizeof(float) : sizeof(double);
+    // staging buffer is complex, butterfly scratch is real
+    size_t elementSizeBytes = 2 * realSizeBytes;
+
+    for(const auto& s : Single2DSizes(ldsSizeBytes, precision, _GetWGSAndNT))
+    {
+        const size_t hermLength = s.first + 1;
+        if((hermLength * s.second * elementSizeBytes) + (hermLength * s.second * realSizeBytes)
+           <= ldsSizeBytes)
+            if(Get2DSingleRealThreadCount(2 * s.first, s.second, _GetWGSAndNT)
+               < MAX_WORK_GROUP_SIZE)
+                retval.push_back(std::make_pair(2 * s.first, s.second));
+    }
+    return retval;
+}
+
 #endif // defined( RADIX_TABLE_H )
@@ -52,7 +52,12 @@ public:
     }
 
     static rocfft_status CreatePlan(rocfft_plan plan);
+    static rocfft_status SetPlanBatch(rocfft_plan plan, size_t batch);
+    static rocfft_status SetPlanCallbacks(rocfft_plan plan, const UserCallbacks& callbacks);
     static void          GetPlan(rocfft_plan plan, ExecPlan& execPlan);
+    static void          GetPlans(const rocfft_plan      plans[],
+                                  size_t                 number_of_plans,
+                                  std::vector<ExecPlan>& execPlans);
     static void          DeletePlan(rocfft_plan plan);
     static size_t        GetUniquePlanCount();
     static size_t        GetTotalPlanCount();
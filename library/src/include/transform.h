@@ -23,23 +23,57 @@
 #ifndef TRANSFORM_H
 #define TRANSFORM_H
 
+#include <vector>
+
+#include "rocfft.h"
 #include "rocfft_hip.h"
 
 struct rocfft_execution_info_t
 {
-    void*       workBuffer;
-    size_t      workBufferSize;
-    hipStream_t rocfft_stream = 0; // by default it is stream 0
+    void*                 workBuffer;
+    size_t                workBufferSize;
+    hipStream_t           rocfft_stream  = 0; // by default it is stream 0
+    bool                  launchGraph    = false;
+    rocfft_execution_mode mode           = rocfft_exec_mode_nonblocking;
+    bool                  kernelEvents   = false;
+    bool                  workBufferPool = false;
+
+    // Completion events recorded by the last rocfft_execute.  The
+    // events are created on first use and reused by later executes,
+    // so recording does not allocate.
+    std::vector<hipEvent_t> eventPool;
+    size_t                  numEvents = 0;
+
     rocfft_execution_info_t()
         : workBuffer(nullptr)
         , workBufferSize(0)
     {
     }
+    ~rocfft_execution_info_t();
+
+    rocfft_execution_info_t(const rocfft_execution_info_t&) = delete;
+    rocfft_execution_info_t& operator=(const rocfft_execution_info_t&) = delete;
+
+    // make at least count events available in eventPool
+    bool ReserveEvents(size_t count);
 };
 
+// Execute a sequence of plans on the execution info's stream.
+// Plans are looked up and the work buffer is validated once for the
+// whole sequence.
+rocfft_status ExecutePlans(const rocfft_plan     plans[],
+                           size_t                number_of_plans,
+                           void**                in_buffers[],
+                           void**                out_buffers[],
+                           rocfft_execution_info info);
+
+// If kernel_events is not null, an event is recorded after each
+// kernel, into consecutive elements of kernel_events.
 void TransformPowX(const ExecPlan&       execPlan,
                    void*                 in_buffer[],
                    void*                 out_buffer[],
-                   rocfft_execution_info info);
+                   void*                 work_buffer,
+                   rocfft_execution_info info,
+                   hipEvent_t*           kernel_events);
 
 #endif // TRANSFORM_H
@@ -31,6 +31,7 @@
 #include "kargs.h"
 #include "rocfft_ostream.hpp"
 #include "twiddles.h"
+#include "user_callbacks.h"
 
 enum OperatingBuffer
 {
@@ -70,6 +71,8 @@ enum ComputeScheme
     CS_KERNEL_PAIR_PACK,
     CS_KERNEL_PAIR_UNPACK,
 
+    CS_KERNEL_STOCKHAM_REAL,
+
     CS_BLUESTEIN,
     CS_KERNEL_CHIRP,
     CS_KERNEL_PAD_MUL,
@@ -85,13 +88,16 @@ enum ComputeScheme
     CS_2D_RC,
     CS_KERNEL_2D_STOCKHAM_BLOCK_CC,
     CS_KERNEL_2D_SINGLE,
+    CS_KERNEL_2D_SINGLE_REAL,
 
     CS_3D_STRAIGHT,
     CS_3D_TRTRTR,
     CS_3D_RTRT,
     CS_3D_RC,
     CS_KERNEL_3D_STOCKHAM_BLOCK_CC,
-    CS_KERNEL_3D_SINGLE
+    CS_KERNEL_3D_SINGLE,
+
+    CS_ND_RTRT
 };
 
 enum TransTileDir
@@ -160,6 +166,9 @@ public:
     // Extra twiddle multiplication for large 1D
     size_t large1D = 0;
 
+    // Input/output buffers are device arrays of per-batch pointers
+    bool batchPointers = false;
+
     // Tree structure:
     // non-owning pointer to parent node, may be null
     TreeNode* parent = nullptr;
@@ -200,7 +209,13 @@ public:
     void RecursiveBuildTree();
 
     bool use_CS_2D_SINGLE(); // To determine using scheme CS_KERNEL_2D_SINGLE or not
+    bool use_CS_2D_SINGLE_REAL(); // To determine using scheme CS_KERNEL_2D_SINGLE_REAL or not
     bool use_CS_2D_RC(); // To determine using scheme CS_2D_RC or not
+    bool use_CS_KERNEL_STOCKHAM_REAL(); // To determine using fused odd-length real kernel or not
+    bool use_CS_L1D_block(ComputeScheme l1dScheme, // To determine if the block kernels
+                          size_t        divLength0, // for CS_L1D_CC or CS_L1D_CRT exist
+                          size_t        divLength1);
+    bool real_data_unit_stride() const; // To determine if real data is unit-stride or not
 
     // Real-complex and complex-real node builders:
     void build_real();
@@ -227,6 +242,10 @@ public:
     // 3D 6 node builder, T: transpose Z_XY, R: row FFTs, T: transpose Z_XY, R: row FFTs, T: transpose Z_XY, R: row FFTs
     void build_CS_3D_TRTRTR();
 
+    // N-D node builders:
+    // N-D 4 node builder, R: (N-1)-D FFTs, T: transpose, R: row FFTs, T: transpose
+    void build_CS_ND_RTRT();
+
     // State maintained while traversing the tree.
     //
     // Preparation and execution of the tree basically involves a
@@ -319,6 +338,7 @@ public:
     void assign_params_CS_3D_RTRT();
     void assign_params_CS_3D_TRTRTR();
     void assign_params_CS_3D_RC_STRAIGHT();
+    void assign_params_CS_ND_RTRT();
 
     // Determine work memory requirements:
     void TraverseTreeCollectLeafsLogicA(std::vector<TreeNode*>& seq,
@@ -355,6 +375,40 @@ struct GridParam
     }
 };
 
+// Base pointers that a kernel's buffers are resolved against at
+// execution time.  Planar user buffers supply two pointers.
+enum LaunchBuffer
+{
+    LB_NONE,
+    LB_USER_IN0,
+    LB_USER_IN1,
+    LB_USER_OUT0,
+    LB_USER_OUT1,
+    LB_WORK
+};
+
+// One buffer argument of a kernel launch: a base pointer plus a
+// byte offset into it.
+struct LaunchBufferRef
+{
+    LaunchBuffer base   = LB_NONE;
+    size_t       offset = 0;
+};
+
+// Everything needed to launch one leaf node, resolved once at plan
+// time so that execution only has to substitute the caller's pointers.
+struct LaunchEntry
+{
+    TreeNode*       node = nullptr;
+    DevFnCall       fn   = nullptr;
+    GridParam       gridParam;
+    LaunchBufferRef bufIn[2];
+    LaunchBufferRef bufOut[2];
+    UserCallbacks   callbacks;
+};
+
+class LaunchGraphCache;
+
 struct ExecPlan
 {
     // shared pointer allows for ExecPlans to be copyable
@@ -366,11 +420,23 @@ struct ExecPlan
 
     std::vector<DevFnCall> devFnCall;
     std::vector<GridParam> gridParam;
-    size_t                 workBufSize      = 0;
-    size_t                 tmpWorkBufSize   = 0;
-    size_t                 copyWorkBufSize  = 0;
-    size_t                 blueWorkBufSize  = 0;
-    size_t                 chirpWorkBufSize = 0;
+
+    // one entry per execSeq node, built by PlanPowX
+    std::vector<LaunchEntry> launchTable;
+
+    // graphs recorded from launchTable, for execution infos that
+    // enable launch graphs
+    std::shared_ptr<LaunchGraphCache> launchGraphs;
+
+    // user load/store callbacks set on the plan, applied by the
+    // launchTable entries of the first and last kernels
+    UserCallbacks callbacks;
+
+    size_t workBufSize      = 0;
+    size_t tmpWorkBufSize   = 0;
+    size_t copyWorkBufSize  = 0;
+    size_t blueWorkBufSize  = 0;
+    size_t chirpWorkBufSize = 0;
 };
 
 void ProcessNode(ExecPlan& execPlan);
@@ -182,5 +182,6 @@ public:
 
 gpubuf twiddles_create(size_t N, rocfft_precision precision, bool large, bool no_radices);
 gpubuf twiddles_create_2D(size_t N1, size_t N2, rocfft_precision precision);
+gpubuf twiddles_create_2D_real(size_t N0, size_t N1, rocfft_precision precision);
 
 #endif // defined( TWIDDLES_H )
@@ -0,0 +1,43 @@
+/******************************************************************************
+* Copyright (c) 2020 - present Advanced Micro Devices, Inc. All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*******************************************************************************/
+
+#ifndef USER_CALLBACKS_H
+#define USER_CALLBACKS_H
+
+// Load and store callbacks of a plan, passed by value to the kernels
+// that read the plan's input or write its output.  The functions are
+// device function pointers; a null function means the kernel reads
+// or writes the buffer directly.  Offsets given to the callbacks are
+// relative to the user's input and output buffers, which the launch
+// fills in as in_base and out_base.
+struct UserCallbacks
+{
+    void* load_fn    = nullptr;
+    void* load_data  = nullptr;
+    void* store_fn   = nullptr;
+    void* store_data = nullptr;
+
+    void* in_base  = nullptr;
+    void* out_base = nullptr;
+};
+
+#endif // USER_CALLBACKS_H
@@ -0,0 +1,97 @@
+/******************************************************************************
+* Copyright (c) 2016 - present Advanced Micro Devices, Inc. All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*******************************************************************************/
+
+#ifndef WORK_BUFFER_POOL_H
+#define WORK_BUFFER_POOL_H
+
+#include <mutex>
+#include <vector>
+
+#include "rocfft_hip.h"
+
+// Caching allocator for work buffers, used by executions that do not
+// provide their own work buffer.
+//
+// Each block belongs to the device and stream it was allocated for, and
+// is only handed out again for work on that stream.  Work on a stream
+// executes in order, so a block released after enqueueing work can be
+// reused by later work on the same stream without the host waiting for
+// the earlier work to finish.  The null stream is a different stream
+// on each device, so the device is part of the key.
+//
+// A destroyed stream's handle may be reused for a new stream while
+// work using a block is still running, so releasing a block records an
+// event on its stream, and reusing the block makes the new work wait
+// for that event on the device.
+class WorkBufferPool
+{
+    WorkBufferPool() {}
+
+public:
+    WorkBufferPool(const WorkBufferPool&) = delete;
+    WorkBufferPool& operator=(const WorkBufferPool&) = delete;
+
+    static WorkBufferPool& GetPool()
+    {
+        static WorkBufferPool pool;
+        return pool;
+    }
+
+    // Get a block of at least size bytes for work on stream, on the
+    // current device.  Returns nullptr if the memory could not be
+    // allocated.
+    void* Acquire(hipStream_t stream, size_t size);
+    // Return a block once work using it has been enqueued on the
+    // stream it was acquired for.
+    void Release(void* buf);
+
+    // Free all blocks that are not currently acquired
+    void Trim();
+
+    // Total bytes currently allocated by the pool, and the most it
+    // has ever had allocated
+    void GetUsage(size_t& pool_bytes, size_t& high_water_bytes);
+
+private:
+    struct Block
+    {
+        int         device;
+        hipStream_t stream;
+        void*       buf;
+        size_t      size;
+        bool        acquired;
+        // recorded on stream when the block was last released, or
+        // nullptr if it never has been
+        hipEvent_t event;
+    };
+
+    void TrimLocked();
+    // Free a block's memory and event, without removing it from blocks
+    void FreeBlock(Block& block);
+
+    std::vector<Block> blocks;
+    size_t             poolBytes      = 0;
+    size_t             highWaterBytes = 0;
+    std::mutex         mtx;
+};
+
+#endif // WORK_BUFFER_POOL_H
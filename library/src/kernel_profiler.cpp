@@ -0,0 +1,116 @@
+/******************************************************************************
+* Copyright (c) 2016 - present Advanced Micro Devices, Inc. All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*******************************************************************************/
+
+#include "kernel_profiler.h"
+#include "logging.h"
+#include "plan.h"
+
+static float execution_bandwidth_GB_per_s(size_t data_size_bytes, float duration_ms)
+{
+    // divide bytes by (1000000 * milliseconds) to get GB/s
+    return static_cast<float>(data_size_bytes) / (1000000.0 * duration_ms);
+}
+
+bool KernelProfiler::GetEvents(hipEvent_t& start, hipEvent_t& stop)
+{
+    std::lock_guard<std::mutex> lck(mtx);
+    while(eventPool.size() < 2)
+    {
+        hipEvent_t event;
+        if(hipEventCreate(&event) != hipSuccess)
+            return false;
+        eventPool.push_back(event);
+    }
+    start = eventPool.back();
+    eventPool.pop_back();
+    stop = eventPool.back();
+    eventPool.pop_back();
+    return true;
+}
+
+void KernelProfiler::Submit(hipEvent_t                 start,
+                            hipEvent_t                 stop,
+                            ComputeScheme              scheme,
+                            const std::vector<size_t>& length,
+                            size_t                     total_size_bytes,
+                            float                      max_memory_bw)
+{
+    std::lock_guard<std::mutex> lck(mtx);
+    pending.push_back({start, stop, scheme, length, total_size_bytes, max_memory_bw});
+}
+
+void KernelProfiler::Harvest(bool wait)
+{
+    std::lock_guard<std::mutex> lck(mtx);
+    // kernels on different streams may finish in any order, so look
+    // at every record rather than stopping at the first unfinished one
+    for(auto it = pending.begin(); it != pending.end();)
+    {
+        if(wait)
+            hipEventSynchronize(it->stop);
+        else if(hipEventQuery(it->stop) != hipSuccess)
+        {
+            ++it;
+            continue;
+        }
+        Emit(*it);
+        eventPool.push_back(it->start);
+        eventPool.push_back(it->stop);
+        it = pending.erase(it);
+    }
+}
+
+void KernelProfiler::Flush()
+{
+    Harvest(true);
+
+    std::lock_guard<std::mutex> lck(mtx);
+    for(auto event : eventPool)
+        hipEventDestroy(event);
+    eventPool.clear();
+}
+
+void KernelProfiler::Emit(const Record& record)
+{
+    float duration_ms = 0.0f;
+    hipEventElapsedTime(&duration_ms, record.start, record.stop);
+    auto exec_bw        = execution_bandwidth_GB_per_s(record.total_size_bytes, duration_ms);
+    auto efficiency_pct = 0.0;
+    if(record.max_memory_bw != 0.0)
+        efficiency_pct = 100.0 * exec_bw / record.max_memory_bw;
+    log_profile("TransformPowX",
+                "scheme",
+                PrintScheme(record.scheme),
+                "duration_ms",
+                duration_ms,
+                "in_size",
+                std::make_pair(static_cast<const size_t*>(record.length.data()),
+                               record.length.size()),
+                "total_size_bytes",
+                record.total_size_bytes,
+                "exec_GB_s",
+                exec_bw,
+                "max_mem_GB_s",
+                record.max_memory_bw,
+                "bw_efficiency_pct",
+                efficiency_pct);
+}
@@ -0,0 +1,151 @@
+/******************************************************************************
+* Copyright (c) 2016 - present Advanced Micro Devices, Inc. All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*******************************************************************************/
+
+#include <algorithm>
+
+#include "launch_graph.h"
+#include "logging.h"
+#include "rocfft.h"
+#include "transform.h"
+#include "tree_node.h"
+
+static bool IsPlanar(rocfft_array_type type)
+{
+    return type == rocfft_array_type_complex_planar || type == rocfft_array_type_hermitian_planar;
+}
+
+LaunchGraphCache::LaunchGraphCache(const ExecPlan& execPlan)
+{
+#ifdef ROCFFT_HAVE_HIP_GRAPH
+    capturable = true;
+    for(auto node : execPlan.execSeq)
+    {
+        // transposes between planar and interleaved data copy the
+        // planar pointers to the device with a blocking hipMemcpy,
+        // which is not allowed while capturing
+        if((node->scheme == CS_KERNEL_TRANSPOSE || node->scheme == CS_KERNEL_TRANSPOSE_XY_Z
+            || node->scheme == CS_KERNEL_TRANSPOSE_Z_XY)
+           && IsPlanar(node->inArrayType) != IsPlanar(node->outArrayType))
+            capturable = false;
+    }
+#endif
+}
+
+LaunchGraphCache::~LaunchGraphCache()
+{
+#ifdef ROCFFT_HAVE_HIP_GRAPH
+    for(auto& entry : entries)
+        hipGraphExecDestroy(entry.graph);
+#endif
+}
+
+bool LaunchGraphCache::Key::operator==(const Key& other) const
+{
+    return stream == other.stream && in[0] == other.in[0] && in[1] == other.in[1]
+           && out[0] == other.out[0] && out[1] == other.out[1] && work == other.work;
+}
+
+bool LaunchGraphCache::Launch(const ExecPlan& execPlan,
+                              void*           in_buffer[],
+                              void*           out_buffer[],
+                              void*           work_buffer,
+                              hipStream_t     stream)
+{
+#ifdef ROCFFT_HAVE_HIP_GRAPH
+    // the null stream cannot be captured, and profiling needs the
+    // kernels to be launched individually
+    if(!capturable || !stream || LOG_PROFILE_ENABLED())
+        return false;
+
+    // if the caller is already capturing this stream, our kernels
+    // just become part of their graph
+    hipStreamCaptureStatus captureStatus = hipStreamCaptureStatusNone;
+    if(hipStreamIsCapturing(stream, &captureStatus) != hipSuccess
+       || captureStatus != hipStreamCaptureStatusNone)
+        return false;
+
+    Key key;
+    key.stream = stream;
+    key.work   = work_buffer;
+    // the second pointer is only present for planar data
+    key.in[0]  = in_buffer[0];
+    key.in[1]  = IsPlanar(execPlan.rootPlan->inArrayType) ? in_buffer[1] : nullptr;
+    key.out[0] = out_buffer[0];
+    key.out[1] = IsPlanar(execPlan.rootPlan->outArrayType) ? out_buffer[1] : nullptr;
+
+    std::lock_guard<std::mutex> lck(mtx);
+
+    auto it = entries.begin();
+    for(; it != entries.end(); ++it)
+    {
+        if(it->key == key)
+            break;
+    }
+
+    if(it == entries.end())
+    {
+        auto seenIt = std::find(seen.begin(), seen.end(), key);
+
+        // first time seeing these buffers - remember them, but launch
+        // directly
+        if(seenIt == seen.end())
+        {
+            seen.push_front(key);
+            if(seen.size() > LAUNCH_GRAPH_CACHE_SIZE)
+                seen.pop_back();
+            return false;
+        }
+        seen.erase(seenIt);
+
+        // record the launch sequence; nothing executes while the
+        // stream is being captured
+        if(hipStreamBeginCapture(stream, hipStreamCaptureModeThreadLocal) != hipSuccess)
+            return false;
+
+        rocfft_execution_info_t info;
+        info.rocfft_stream = stream;
+        TransformPowX(execPlan, in_buffer, out_buffer, work_buffer, &info, nullptr);
+
+        hipGraph_t graph = nullptr;
+        if(hipStreamEndCapture(stream, &graph) != hipSuccess || !graph)
+            return false;
+        hipGraphExec_t graphExec = nullptr;
+        auto           ret       = hipGraphInstantiate(&graphExec, graph, nullptr, nullptr, 0);
+        hipGraphDestroy(graph);
+        if(ret != hipSuccess)
+            return false;
+
+        entries.push_front({key, graphExec});
+        if(entries.size() > LAUNCH_GRAPH_CACHE_SIZE)
+        {
+            hipGraphExecDestroy(entries.back().graph);
+            entries.pop_back();
+        }
+    }
+    else
+        entries.splice(entries.begin(), entries, it);
+
+    return hipGraphLaunch(entries.front().graph, stream) == hipSuccess;
+#else
+    return false;
+#endif
+}
@@ -29,6 +29,7 @@
 #include "rocfft_ostream.hpp"
 
 #include <algorithm>
+#include <array>
 #include <assert.h>
 #include <map>
 #include <numeric>
@@ -75,6 +76,8 @@ std::string PrintScheme(ComputeScheme cs)
            {ENUMSTR(CS_KERNEL_PAIR_PACK)},
            {ENUMSTR(CS_KERNEL_PAIR_UNPACK)},
 
+           {ENUMSTR(CS_KERNEL_STOCKHAM_REAL)},
+
            {ENUMSTR(CS_BLUESTEIN)},
            {ENUMSTR(CS_KERNEL_CHIRP)},
            {ENUMSTR(CS_KERNEL_PAD_MUL)},
@@ -90,13 +93,16 @@ std::string PrintScheme(ComputeScheme cs)
            {ENUMSTR(CS_2D_RC)},
            {ENUMSTR(CS_KERNEL_2D_STOCKHAM_BLOCK_CC)},
            {ENUMSTR(CS_KERNEL_2D_SINGLE)},
+           {ENUMSTR(CS_KERNEL_2D_SINGLE_REAL)},
 
            {ENUMSTR(CS_3D_STRAIGHT)},
            {ENUMSTR(CS_3D_TRTRTR)},
            {ENUMSTR(CS_3D_RTRT)},
            {ENUMSTR(CS_3D_RC)},
            {ENUMSTR(CS_KERNEL_3D_STOCKHAM_BLOCK_CC)},
-           {ENUMSTR(CS_KERNEL_3D_SINGLE)}};
+           {ENUMSTR(CS_KERNEL_3D_SINGLE)},
+
+           {ENUMSTR(CS_ND_RTRT)}};
 
     return ComputeSchemetoString.at(cs);
 }
@@ -138,6 +144,14 @@ rocfft_status rocfft_plan_description_set_scale_double(rocfft_plan_description d
     return rocfft_status_success;
 }
 
+rocfft_status rocfft_plan_description_set_batch_pointers(rocfft_plan_description description,
+                                                        const int               enable)
+{
+    log_trace(__func__, "description", description, "enable", enable);
+    description->batchPointers = enable ? 1 : 0;
+    return rocfft_status_success;
+}
+
 static size_t offset_count(rocfft_array_type type)
 {
     // planar data has 2 sets of offsets, otherwise we have one
@@ -199,7 +213,7 @@ rocfft_status rocfft_plan_description_set_data_layout(rocfft_plan_description de
 
     if(in_strides != nullptr)
     {
-        for(size_t i = 0; i < std::min((size_t)3, in_strides_size); i++)
+        for(size_t i = 0; i < std::min((size_t)ROCFFT_MAX_RANK, in_strides_size); i++)
             description->inStrides[i] = in_strides[i];
     }
 
@@ -208,7 +222,7 @@ rocfft_status rocfft_plan_description_set_data_layout(rocfft_plan_description de
 
     if(out_strides != nullptr)
     {
-        for(size_t i = 0; i < std::min((size_t)3, out_strides_size); i++)
+        for(size_t i = 0; i < std::min((size_t)ROCFFT_MAX_RANK, out_strides_size); i++)
             description->outStrides[i] = out_strides[i];
     }
 
@@ -293,16 +307,36 @@ rocfft_status rocfft_plan_create_internal(rocfft_plan                   plan,
                 return rocfft_status_invalid_array_type;
             break;
         }
+
+        // Per-batch pointers are only supported for 1D interleaved
+        // complex transforms, and replace the buffer offsets
+        if(description->batchPointers)
+        {
+            if(transform_type != rocfft_transform_type_complex_forward
+               && transform_type != rocfft_transform_type_complex_inverse)
+                return rocfft_status_invalid_arg_value;
+            if(description->inArrayType != rocfft_array_type_complex_interleaved
+               || description->outArrayType != rocfft_array_type_complex_interleaved)
+                return rocfft_status_invalid_array_type;
+            if(dimensions != 1)
+                return rocfft_status_invalid_dimensions;
+            if(description->inOffset[0] != 0 || description->outOffset[0] != 0)
+                return rocfft_status_invalid_offset;
+        }
     }
 
-    if(dimensions > 3)
+    if(dimensions > ROCFFT_MAX_RANK)
+        return rocfft_status_invalid_dimensions;
+
+    // Real transforms are only decomposed up to 3 dimensions
+    if(dimensions > 3
+       && (transform_type == rocfft_transform_type_real_forward
+           || transform_type == rocfft_transform_type_real_inverse))
         return rocfft_status_invalid_dimensions;
 
     rocfft_plan p = plan;
     p->rank       = dimensions;
-    p->lengths[0] = 1;
-    p->lengths[1] = 1;
-    p->lengths[2] = 1;
+    p->lengths.fill(1);
     for(size_t ilength = 0; ilength < dimensions; ++ilength)
     {
         p->lengths[ilength] = lengths[ilength];
@@ -465,14 +499,6 @@ rocfft_status rocfft_plan_create(rocfft_plan*                  plan,
 {
     rocfft_plan_allocate(plan);
 
-    size_t log_len[3] = {1, 1, 1};
-    if(dimensions > 0)
-        log_len[0] = lengths[0];
-    if(dimensions > 1)
-        log_len[1] = lengths[1];
-    if(dimensions > 2)
-        log_len[2] = lengths[2];
-
     log_trace(__func__,
               "plan",
               *plan,
@@ -491,22 +517,40 @@ rocfft_status rocfft_plan_create(rocfft_plan*                  plan,
               "description",
               description);
 
+    // rider takes lengths and strides in row-major order, slowest
+    // dimension first
     std::stringstream ss;
-    ss << "./rocfft-rider"
-       << " -t " << transform_type << " -x " << log_len[0] << " -y " << log_len[1] << " -z "
-       << log_len[2] << " -b " << number_of_transforms;
+    ss << "./rocfft-rider -t " << transform_type << " --length";
+    for(size_t i = dimensions; i > 0; --i)
+        ss << " " << lengths[i - 1];
+    ss << " -b " << number_of_transforms;
     if(placement == rocfft_placement_notinplace)
         ss << " -o ";
     if(precision == rocfft_precision_double)
         ss << " --double ";
     if(description != NULL)
-        ss << " --isX " << description->inStrides[0] << " --isY " << description->inStrides[1]
-           << " --isZ " << description->inStrides[2] << " --osX " << description->outStrides[0]
-           << " --osY " << description->outStrides[1] << " --osZ " << description->outStrides[2]
-           << " --scale " << description->scale << " --iOff0 " << description->inOffset[0]
-           << " --iOff1 " << description->inOffset[1] << " --oOff0 " << description->outOffset[0]
-           << " --oOff1 " << description->outOffset[1] << " --inArrType "
-           << description->inArrayType << " --outArrType " << description->outArrayType;
+    {
+        if(description->inStrides[0] != 0)
+        {
+            ss << " --istride";
+            for(size_t i = dimensions; i > 0; --i)
+                ss << " " << description->inStrides[i - 1];
+        }
+        if(description->outStrides[0] != 0)
+        {
+            ss << " --ostride";
+            for(size_t i = dimensions; i > 0; --i)
+                ss << " " << description->outStrides[i - 1];
+        }
+        if(description->inDist != 0)
+            ss << " --idist " << description->inDist;
+        if(description->outDist != 0)
+            ss << " --odist " << description->outDist;
+        ss << " --scale " << description->scale << " --ioffset " << description->inOffset[0]
+           << " " << description->inOffset[1] << " --ooffset " << description->outOffset[0]
+           << " " << description->outOffset[1] << " --itype " << description->inArrayType
+           << " --otype " << description->outArrayType;
+    }
 
     log_bench(ss.str());
 
@@ -520,6 +564,42 @@ rocfft_status rocfft_plan_create(rocfft_plan*                  plan,
                                        description);
 }
 
+rocfft_status rocfft_plan_set_batch(rocfft_plan plan, const size_t number_of_transforms)
+{
+    log_trace(__func__, "plan", plan, "number_of_transforms", number_of_transforms);
+    if(plan == nullptr || number_of_transforms == 0)
+        return rocfft_status_invalid_arg_value;
+    return Repo::GetRepo().SetPlanBatch(plan, number_of_transforms);
+}
+
+rocfft_status rocfft_plan_set_load_callback(rocfft_plan plan, void* cb_function, void* cb_data)
+{
+    log_trace(__func__, "plan", plan, "cb_function", cb_function, "cb_data", cb_data);
+    if(plan == nullptr)
+        return rocfft_status_invalid_arg_value;
+
+    ExecPlan execPlan;
+    Repo::GetPlan(plan, execPlan);
+    UserCallbacks callbacks = execPlan.callbacks;
+    callbacks.load_fn       = cb_function;
+    callbacks.load_data     = cb_data;
+    return Repo::SetPlanCallbacks(plan, callbacks);
+}
+
+rocfft_status rocfft_plan_set_store_callback(rocfft_plan plan, void* cb_function, void* cb_data)
+{
+    log_trace(__func__, "plan", plan, "cb_function", cb_function, "cb_data", cb_data);
+    if(plan == nullptr)
+        return rocfft_status_invalid_arg_value;
+
+    ExecPlan execPlan;
+    Repo::GetPlan(plan, execPlan);
+    UserCallbacks callbacks = execPlan.callbacks;
+    callbacks.store_fn      = cb_function;
+    callbacks.store_data    = cb_data;
+    return Repo::SetPlanCallbacks(plan, callbacks);
+}
+
 rocfft_status rocfft_plan_destroy(rocfft_plan plan)
 {
     log_trace(__func__, "plan", plan);
@@ -700,6 +780,30 @@ ROCFFT_EXPORT rocfft_status rocfft_repo_get_total_plan_count(size_t* count)
     return rocfft_status_success;
 }
 
+ROCFFT_EXPORT rocfft_status rocfft_plan_get_kernel_schemes(const rocfft_plan plan,
+                                                           char*             buf,
+                                                           size_t            buf_size)
+{
+    if(plan == nullptr || buf == nullptr)
+        return rocfft_status_invalid_arg_value;
+
+    ExecPlan execPlan;
+    Repo::GetPlan(plan, execPlan);
+
+    std::string schemes;
+    for(auto node : execPlan.execSeq)
+    {
+        if(!schemes.empty())
+            schemes += " ";
+        schemes += PrintScheme(node->scheme);
+    }
+    if(schemes.size() >= buf_size)
+        return rocfft_status_invalid_arg_value;
+    std::copy(schemes.begin(), schemes.end(), buf);
+    buf[schemes.size()] = '\0';
+    return rocfft_status_success;
+}
+
 // Tree node builders
 
 // NB:
@@ -841,20 +945,26 @@ void TreeNode::RecursiveBuildTree()
     break;
 
     default:
-        assert(false);
+    {
+        assert(dimension > 3);
+
+        // Higher ranks peel off the slowest dimension; the remaining
+        // (N-1)-D transform is built recursively.
+        scheme = CS_ND_RTRT;
+        build_CS_ND_RTRT();
+    }
     }
 }
 
-bool TreeNode::use_CS_2D_SINGLE()
+// Get actual LDS size, to check if we can run a 2D_SINGLE kernel
+// that will fit the problem into LDS.
+//
+// NOTE: This is potentially problematic in a heterogeneous
+// multi-device environment.  The device we query now could differ
+// from the device we run the plan on.  That said, it's vastly more
+// common to have multiples of the same device in the real world.
+static int GetDeviceLDSSize()
 {
-    // Get actual LDS size, to check if we can run a 2D_SINGLE
-    // kernel that will fit the problem into LDS.
-    //
-    // NOTE: This is potentially problematic in a heterogeneous
-    // multi-device environment.  The device we query now could
-    // differ from the device we run the plan on.  That said,
-    // it's vastly more common to have multiples of the same
-    // device in the real world.
     int ldsSize;
     int deviceid;
     // if this fails, device 0 is a reasonable default
@@ -873,25 +983,57 @@ bool TreeNode::use_CS_2D_SINGLE()
                   "hipDeviceGetAttribute failed - assuming normal LDS size for current hardware");
         ldsSize = 0;
     }
-    const auto single2DSizes = Single2DSizes(ldsSize, precision, GetWGSAndNT);
-    if(std::find(single2DSizes.begin(), single2DSizes.end(), std::make_pair(length[0], length[1]))
-       != single2DSizes.end())
-        return true;
+    return ldsSize;
+}
 
-    return false;
+// A 2D single kernel does a whole transform in one threadblock, so
+// it can only run if the LDS it declares fits on the device.
+static bool Fits2DSingleLDS(rocfft_precision                                  precision,
+                            const std::tuple<size_t, size_t, ComputeScheme>& key)
+{
+    if(!function_pool::has_function_2D(precision, key))
+        return false;
+
+    // kernels were generated for at most 64 KiB of LDS
+    static const size_t MAX_LDS_SIZE_BYTES = 64 * 1024;
+    size_t              ldsSizeBytes       = GetDeviceLDSSize();
+    if(ldsSizeBytes == 0)
+        ldsSizeBytes = MAX_LDS_SIZE_BYTES;
+    else
+        ldsSizeBytes = std::min(ldsSizeBytes, MAX_LDS_SIZE_BYTES);
+
+    return function_pool::get_metadata_2D(precision, key).ldsBytes <= ldsSizeBytes;
+}
+
+bool TreeNode::use_CS_2D_SINGLE()
+{
+    return Fits2DSingleLDS(precision, std::make_tuple(length[0], length[1], CS_KERNEL_2D_SINGLE));
+}
+
+bool TreeNode::use_CS_2D_SINGLE_REAL()
+{
+    // The fused real kernel reads each row as a half-length complex
+    // sequence, so the fastest dimension must be even.
+    if(dimension != 2 || length[0] % 2 != 0)
+        return false;
+
+    return Fits2DSingleLDS(precision,
+                           std::make_tuple(length[0], length[1], CS_KERNEL_2D_SINGLE_REAL));
 }
 
 bool TreeNode::use_CS_2D_RC()
 {
-    //   For CS_2D_RC, we are reusing SBCC kernel for 1D middle size. The
-    //   current implementation of 1D SBCC supports only 64, 128, and 256.
-    //   However, technically no LDS limitation along the fast dimension
-    //   on upper bound for 2D SBCC cases, and even should not limit to pow
-    //   of 2.
-    if((length[1] == 256 || length[1] == 128 || length[1] == 64) && (length[0] >= 64))
-    {
-        size_t bwd, wgs, lds;
-        GetBlockComputeTable(length[1], bwd, wgs, lds);
+    //   For CS_2D_RC, we are reusing SBCC kernel for 1D middle size.
+    //   SBCC kernels are generated for the lengths up to 512 whose
+    //   block of columns fits in LDS, and each block must cover whole
+    //   columns of the fast dimension.
+    if(length[0] >= 64
+       && function_pool::has_function(precision, {length[1], CS_KERNEL_STOCKHAM_BLOCK_CC}))
+    {
+        // each block of the SBCC kernel covers this many columns
+        size_t bwd
+            = function_pool::get_metadata(precision, {length[1], CS_KERNEL_STOCKHAM_BLOCK_CC})
+                  .transforms;
         if(length[0] % bwd == 0)
         {
             return true;
@@ -901,9 +1043,77 @@ bool TreeNode::use_CS_2D_RC()
     return false;
 }
 
+bool TreeNode::use_CS_KERNEL_STOCKHAM_REAL()
+{
+    // Fused real kernels are only generated for odd lengths whose
+    // transforms fit in LDS, so ask the function pool.
+    if(dimension != 1 || length[0] % 2 == 0 || length[0] > Large1DThreshold(precision))
+        return false;
+
+    // function pool throws if the size was not found
+    try
+    {
+        switch(precision)
+        {
+        case rocfft_precision_single:
+            function_pool::get_function_single({length[0], CS_KERNEL_STOCKHAM_REAL});
+            return true;
+        case rocfft_precision_double:
+            function_pool::get_function_double({length[0], CS_KERNEL_STOCKHAM_REAL});
+            return true;
+        }
+    }
+    catch(std::exception&)
+    {
+    }
+    return false;
+}
+
+bool TreeNode::use_CS_L1D_block(ComputeScheme l1dScheme, size_t divLength0, size_t divLength1)
+{
+    // Both schemes start with a column-to-column block kernel, then
+    // finish with a row-to-column block kernel (CC) or a row kernel
+    // and a transpose (CRT).  The blocks of each block kernel must
+    // cover whole columns of the other length.
+    auto blockDivides = [this](size_t len, ComputeScheme blockScheme, size_t otherLength) {
+        if(!function_pool::has_function(precision, {len, blockScheme}))
+            return false;
+        const auto& metadata = function_pool::get_metadata(precision, {len, blockScheme});
+        return otherLength % metadata.transforms == 0;
+    };
+
+    if(!blockDivides(divLength1, CS_KERNEL_STOCKHAM_BLOCK_CC, divLength0))
+        return false;
+    if(l1dScheme == CS_L1D_CC)
+        return blockDivides(divLength0, CS_KERNEL_STOCKHAM_BLOCK_RC, divLength1);
+    return function_pool::has_function(precision, {divLength0, CS_KERNEL_STOCKHAM});
+}
+
+bool TreeNode::real_data_unit_stride() const
+{
+    // The real data is the user's input for forward transforms and
+    // the user's output for inverse transforms.
+    auto root = this;
+    while(root->parent != nullptr)
+        root = root->parent;
+    return (direction == -1 ? root->inStride[0] : root->outStride[0]) == 1;
+}
+
 void TreeNode::build_real()
 {
-    if(length[0] % 2 == 0 && inStride[0] == 1 && outStride[0] == 1)
+    // Small 2D transforms with an even first dimension are done by a
+    // single fused kernel, which keeps the whole image in LDS.
+    if(use_CS_2D_SINGLE_REAL())
+    {
+        scheme = CS_KERNEL_2D_SINGLE_REAL;
+        return;
+    }
+
+    // Even lengths with non-unit real strides view the real data as
+    // planar complex, which requires a single-kernel c2c sub-transform.
+    if(length[0] % 2 == 0
+       && (real_data_unit_stride()
+           || function_pool::has_function(precision, {length[0] / 2, CS_KERNEL_STOCKHAM})))
     {
         switch(dimension)
         {
@@ -922,6 +1132,14 @@ void TreeNode::build_real()
         }
     }
 
+    // Odd lengths that fit in one threadblock are done by a single
+    // fused kernel, which reads the input and writes the output once.
+    if(use_CS_KERNEL_STOCKHAM_REAL())
+    {
+        scheme = CS_KERNEL_STOCKHAM_REAL;
+        return;
+    }
+
     // TODO: use otherdims for non-batched paired transform.
     // Recall that the lengths are column-major.
     // const size_t otherdims
@@ -929,7 +1147,7 @@ void TreeNode::build_real()
 
     // NB: currently only works with single-kernel c2c sub-transform
     // TODO: enable for 2D/3D transforms.
-    if(dimension == 1 && direction == -1 && SupportedLength(precision, length[0])
+    if(dimension == 1 && function_pool::has_function(precision, {length[0], CS_KERNEL_STOCKHAM})
        && length[0] < Large1DThreshold(precision) && (batch % 2 == 0)) // || (otherdims % 2 == 0))
     {
         // Paired algorithm
@@ -988,7 +1206,11 @@ void TreeNode::build_real_even_1D()
     cfftPlan->length    = length;
     cfftPlan->length[0] = cfftPlan->length[0] / 2;
 
-    cfftPlan->placement = rocfft_placement_inplace;
+    // Real data with non-unit stride can't be treated as interleaved
+    // complex data, so the c2c transform reads (or writes) it as planar
+    // complex data and goes through a temporary buffer instead.
+    cfftPlan->placement
+        = real_data_unit_stride() ? rocfft_placement_inplace : rocfft_placement_notinplace;
 
     switch(direction)
     {
@@ -1371,24 +1593,81 @@ void TreeNode::build_real_pair()
     {
         // Inverse
 
-        // TODO: implement
-        assert(false);
+        // Pack the two Hermitian-symmetric arrays into one full-length planar complex array
+        {
+            auto pack          = TreeNode::CreateNode(this);
+            pack->scheme       = CS_KERNEL_PAIR_PACK;
+            pack->dimension    = 1;
+            pack->length       = pairlength;
+            pack->batch        = pairbatch;
+            pack->pairdim      = c2c_pairdim;
+            pack->inArrayType  = inArrayType;
+            pack->outArrayType = rocfft_array_type_complex_planar;
+            childNodes.emplace_back(std::move(pack));
+        }
+
+        // Second stage: perform a c2c FFT which produces the two real output arrays as the real
+        // and imaginary parts in planar format
+        {
+            auto cplan          = TreeNode::CreateNode(this);
+            cplan->length       = pairlength;
+            cplan->batch        = pairbatch;
+            cplan->pairdim      = c2c_pairdim;
+            cplan->dimension    = 1;
+            cplan->inArrayType  = rocfft_array_type_complex_planar;
+            cplan->outArrayType = rocfft_array_type_complex_planar;
+            cplan->RecursiveBuildTree();
+            childNodes.emplace_back(std::move(cplan));
+        }
     }
 }
 
 size_t TreeNode::div1DNoPo2(const size_t length0)
 {
-    const size_t supported[]
-        = {4096, 4050, 4000, 3888, 3840, 3750, 3645, 3600, 3456, 3375, 3240, 3200, 3125, 3072,
-           3000, 2916, 2880, 2700, 2592, 2560, 2500, 2430, 2400, 2304, 2250, 2187, 2160, 2048,
-           2025, 2000, 1944, 1920, 1875, 1800, 1728, 1620, 1600, 1536, 1500, 1458, 1440, 1350,
-           1296, 1280, 1250, 1215, 1200, 1152, 1125, 1080, 1024, 1000, 972,  960,  900,  864,
-           810,  800,  768,  750,  729,  720,  675,  648,  640,  625,  600,  576,  540,  512,
-           500,  486,  480,  450,  432,  405,  400,  384,  375,  360,  324,  320,  300,  288,
-           270,  256,  250,  243,  240,  225,  216,  200,  192,  180,  162,  160,  150,  144,
-           135,  128,  125,  120,  108,  100,  96,   90,   81,   80,   75,   72,   64,   60,
-           54,   50,   48,   45,   40,   36,   32,   30,   27,   25,   24,   20,   18,   16,
-           15,   12,   10,   9,    8,    6,    5,    4,    3,    2,    1};
+    // only split off lengths that have a kernel; if none do, this
+    // returns length0 itself
+    auto has_kernel = [this](size_t len) {
+        return function_pool::has_function(precision, {len, CS_KERNEL_STOCKHAM});
+    };
+
+    // Candidate lengths, in descending order, are made of radices 2,
+    // 3 and 5, and whichever of 7, 11 and 13 divide length0.  Lengths
+    // without a 7, 11 or 13 factor therefore split as they always have.
+    // There are only eight such sets of radices, so the candidates for
+    // each are built once, indexed by a bit per radix 7, 11 and 13.
+    static const size_t extraRadices[] = {7, 11, 13};
+
+    static const auto candidates = []() {
+        std::array<std::vector<size_t>, 8> lists;
+        for(size_t mask = 0; mask < lists.size(); ++mask)
+        {
+            for(size_t len = 4096; len >= 1; --len)
+            {
+                size_t p = len;
+                for(size_t radix : {2, 3, 5})
+                {
+                    while(p % radix == 0)
+                        p /= radix;
+                }
+                for(size_t i = 0; i < 3; ++i)
+                {
+                    while((mask & (1 << i)) && p % extraRadices[i] == 0)
+                        p /= extraRadices[i];
+                }
+                if(p == 1)
+                    lists[mask].push_back(len);
+            }
+        }
+        return lists;
+    }();
+
+    size_t mask = 0;
+    for(size_t i = 0; i < 3; ++i)
+    {
+        if(length0 % extraRadices[i] == 0)
+            mask |= 1 << i;
+    }
+    const std::vector<size_t>& supported = candidates[mask];
 
     size_t idx;
     if(length0 > (Large1DThreshold(precision) * Large1DThreshold(precision)))
@@ -1398,7 +1677,7 @@ size_t TreeNode::div1DNoPo2(const size_t length0)
         {
             idx++;
         }
-        while(length0 % supported[idx] != 0)
+        while(length0 % supported[idx] != 0 || !has_kernel(supported[idx]))
         {
             idx++;
         }
@@ -1407,17 +1686,17 @@ size_t TreeNode::div1DNoPo2(const size_t length0)
     {
         // logic tries to break into as squarish matrix as possible
         size_t sqr = (size_t)sqrt(length0);
-        idx        = sizeof(supported) / sizeof(supported[0]) - 1;
+        idx        = supported.size() - 1;
         while(supported[idx] < sqr)
         {
             idx--;
         }
-        while(length0 % supported[idx] != 0)
+        while(length0 % supported[idx] != 0 || !has_kernel(supported[idx]))
         {
             idx++;
         }
     }
-    assert(idx < sizeof(supported) / sizeof(supported[0]));
+    assert(idx < supported.size());
     return length0 / supported[idx];
 }
 
@@ -1433,7 +1712,23 @@ void TreeNode::build_1D()
 
     if(length[0] <= Large1DThreshold(precision)) // single kernel algorithm
     {
-        scheme = CS_KERNEL_STOCKHAM;
+        if(function_pool::has_function(precision, {length[0], CS_KERNEL_STOCKHAM}))
+        {
+            scheme = CS_KERNEL_STOCKHAM;
+            return;
+        }
+
+        // No kernel was generated for this length, so split it into
+        // lengths that have one.  Bluestein covers lengths that can't
+        // be split that way, since all power-of-2 kernels are built.
+        const size_t divLength1 = div1DNoPo2(length[0]);
+        if(divLength1 == length[0])
+        {
+            build_1DBluestein();
+            return;
+        }
+        scheme = CS_L1D_TRTRT;
+        build_1DCS_L1D_TRTRT(length[0] / divLength1, divLength1);
         return;
     }
 
@@ -1469,7 +1764,8 @@ void TreeNode::build_1D()
             }
             scheme = (length[0] <= 65536 / PrecisionWidth(precision)) ? CS_L1D_CC : CS_L1D_CRT;
         }
-        else
+        if(length[0] > 262144 / PrecisionWidth(precision)
+           || !use_CS_L1D_block(scheme, length[0] / divLength1, divLength1))
         {
             if(length[0] > (Large1DThreshold(precision) * Large1DThreshold(precision)))
             {
@@ -1497,7 +1793,10 @@ void TreeNode::build_1D()
 
         if(precision == rocfft_precision_single)
         {
-            if(map1DLengthSingle.find(length[0]) != map1DLengthSingle.end())
+            if(map1DLengthSingle.find(length[0]) != map1DLengthSingle.end()
+               && use_CS_L1D_block(CS_L1D_CC,
+                                   length[0] / map1DLengthSingle.at(length[0]),
+                                   map1DLengthSingle.at(length[0])))
             {
                 divLength1 = map1DLengthSingle.at(length[0]);
                 scheme     = CS_L1D_CC;
@@ -1505,12 +1804,30 @@ void TreeNode::build_1D()
         }
         else if(precision == rocfft_precision_double)
         {
-            if(map1DLengthDouble.find(length[0]) != map1DLengthDouble.end())
+            if(map1DLengthDouble.find(length[0]) != map1DLengthDouble.end()
+               && use_CS_L1D_block(CS_L1D_CC,
+                                   length[0] / map1DLengthDouble.at(length[0]),
+                                   map1DLengthDouble.at(length[0])))
             {
                 divLength1 = map1DLengthDouble.at(length[0]);
                 scheme     = CS_L1D_CC;
             }
         }
+
+        // otherwise do the default split with block kernels, if they
+        // were generated for both of its lengths
+        if(scheme == CS_L1D_TRTRT && divLength1 != length[0]
+           && use_CS_L1D_block(CS_L1D_CC, length[0] / divLength1, divLength1))
+        {
+            scheme = CS_L1D_CC;
+        }
+
+        // no generated kernel divides this length
+        if(divLength1 == length[0])
+        {
+            build_1DBluestein();
+            return;
+        }
     }
 
     size_t divLength0 = length[0] / divLength1;
@@ -1932,6 +2249,10 @@ void TreeNode::build_CS_3D_RTRT()
     zPlan->length.push_back(length[2]);
     zPlan->length.push_back(length[0]);
     zPlan->length.push_back(length[1]);
+    for(size_t index = 3; index < length.size(); index++)
+    {
+        zPlan->length.push_back(length[index]);
+    }
     zPlan->RecursiveBuildTree();
 
     // second transpose
@@ -1969,6 +2290,61 @@ void TreeNode::build_CS_3D_TRTRTR()
     }
 }
 
+void TreeNode::build_CS_ND_RTRT()
+{
+    // Dimensions above the (N-1)-D sub-transform and the 1D
+    // transform along the slowest dimension are folded into the
+    // batch of each child.
+    const size_t last = dimension - 1;
+
+    // (N-1)-D fft
+    auto subPlan       = TreeNode::CreateNode(this);
+    subPlan->length    = length;
+    subPlan->dimension = last;
+    subPlan->RecursiveBuildTree();
+    childNodes.emplace_back(std::move(subPlan));
+
+    // first transpose, swapping the fastest and slowest dimensions
+    auto trans1Plan = TreeNode::CreateNode(this);
+
+    trans1Plan->length.push_back(length[0]);
+    trans1Plan->length.push_back(length[last]);
+
+    trans1Plan->scheme    = CS_KERNEL_TRANSPOSE;
+    trans1Plan->dimension = 2;
+
+    for(size_t index = 1; index < length.size(); index++)
+    {
+        if(index != last)
+            trans1Plan->length.push_back(length[index]);
+    }
+
+    childNodes.emplace_back(std::move(trans1Plan));
+
+    // row fft along the slowest dimension
+    auto rowPlan = TreeNode::CreateNode(this);
+
+    rowPlan->length.push_back(length[last]);
+    rowPlan->dimension = 1;
+    rowPlan->length.push_back(length[0]);
+
+    for(size_t index = 1; index < length.size(); index++)
+    {
+        if(index != last)
+            rowPlan->length.push_back(length[index]);
+    }
+
+    rowPlan->RecursiveBuildTree();
+
+    // second transpose
+    auto trans2Plan       = TreeNode::CreateNode(this);
+    trans2Plan->length    = rowPlan->length;
+    trans2Plan->scheme    = CS_KERNEL_TRANSPOSE;
+    trans2Plan->dimension = 2;
+    childNodes.emplace_back(std::move(rowPlan));
+    childNodes.emplace_back(std::move(trans2Plan));
+}
+
 struct TreeNode::TraverseState
 {
     TraverseState(const ExecPlan& execPlan)
@@ -2122,6 +2498,7 @@ void TreeNode::TraverseTreeAssignBuffersLogicA(TraverseState&   state,
         break;
     case CS_2D_RTRT:
     case CS_3D_RTRT:
+    case CS_ND_RTRT:
         assign_buffers_CS_RTRT(state, flipIn, flipOut, obOutBuf);
         break;
     case CS_2D_RC:
@@ -2230,11 +2607,22 @@ void TreeNode::assign_buffers_CS_REAL_TRANSFORM_EVEN(TraverseState&   state,
 
         // complex FFT kernel
         childNodes[0]->SetInputBuffer(state);
-        childNodes[0]->obOut        = obIn;
-        childNodes[0]->inArrayType  = rocfft_array_type_complex_interleaved;
+        if(real_data_unit_stride())
+        {
+            childNodes[0]->obOut       = obIn;
+            childNodes[0]->inArrayType = rocfft_array_type_complex_interleaved;
+            flipIn                     = obIn;
+            obOutBuf                   = obIn;
+        }
+        else
+        {
+            // strided real input is read as planar complex data
+            childNodes[0]->obOut       = OB_TEMP_CMPLX_FOR_REAL;
+            childNodes[0]->inArrayType = rocfft_array_type_complex_planar;
+            flipIn                     = OB_TEMP_CMPLX_FOR_REAL;
+            obOutBuf                   = OB_TEMP_CMPLX_FOR_REAL;
+        }
         childNodes[0]->outArrayType = rocfft_array_type_complex_interleaved;
-        flipIn                      = obIn;
-        obOutBuf                    = obIn;
         childNodes[0]->TraverseTreeAssignBuffersLogicA(state, flipIn, flipOut, obOutBuf);
 
         // real-to-complex post kernel
@@ -2249,7 +2637,7 @@ void TreeNode::assign_buffers_CS_REAL_TRANSFORM_EVEN(TraverseState&   state,
 
         // complex-to-real pre kernel
         childNodes[0]->SetInputBuffer(state);
-        childNodes[0]->obOut = obOut;
+        childNodes[0]->obOut = real_data_unit_stride() ? obOut : OB_TEMP_CMPLX_FOR_REAL;
 
         childNodes[0]->inArrayType  = inArrayType;
         childNodes[0]->outArrayType = rocfft_array_type_complex_interleaved;
@@ -2267,8 +2655,11 @@ void TreeNode::assign_buffers_CS_REAL_TRANSFORM_EVEN(TraverseState&   state,
         childNodes[1]->obOut = obOut;
         flipIn               = placement == rocfft_placement_inplace ? OB_USER_IN : OB_USER_OUT;
         flipOut              = OB_TEMP;
-        childNodes[1]->inArrayType  = rocfft_array_type_complex_interleaved;
-        childNodes[1]->outArrayType = rocfft_array_type_complex_interleaved;
+        childNodes[1]->inArrayType = rocfft_array_type_complex_interleaved;
+        // strided real output is written as planar complex data
+        childNodes[1]->outArrayType = real_data_unit_stride()
+                                          ? rocfft_array_type_complex_interleaved
+                                          : rocfft_array_type_complex_planar;
         childNodes[1]->TraverseTreeAssignBuffersLogicA(state, flipIn, flipOut, obOutBuf);
     }
 }
@@ -2501,8 +2892,20 @@ void TreeNode::assign_buffers_CS_REAL_TRANSFORM_PAIR(TraverseState&   state,
     }
     else
     {
-        assert(false);
-        // TODO: implement
+        auto& pack = childNodes[0];
+        assert(pack->scheme == CS_KERNEL_PAIR_PACK);
+        // The pack plan cannot be in-place due to a race condition, so in-place transforms
+        // go through the temp buffer.
+        pack->SetInputBuffer(state);
+        pack->obOut = (placement == rocfft_placement_inplace) ? OB_TEMP : obOut;
+
+        auto& cplan = childNodes[1];
+        cplan->SetInputBuffer(state);
+        cplan->obOut = obOut;
+        cplan->TraverseTreeAssignBuffersLogicA(state, flipIn, flipOut, obOutBuf);
+
+        assert(dimension == 1);
+        // TODO: implment multi-dimensional transforms
     }
 }
 
@@ -2995,6 +3398,9 @@ void TreeNode::TraverseTreeAssignParamsLogicA()
     case CS_3D_STRAIGHT:
         assign_params_CS_3D_RC_STRAIGHT();
         break;
+    case CS_ND_RTRT:
+        assign_params_CS_ND_RTRT();
+        break;
     default:
         return;
     }
@@ -3040,21 +3446,38 @@ void TreeNode::assign_params_CS_REAL_TRANSFORM_EVEN()
     {
         // forward transform, r2c
 
-        // iDist is in reals, subplan->iDist is in complexes
-
-        auto& fftPlan     = childNodes[0];
-        fftPlan->inStride = inStride;
-        for(int i = 1; i < fftPlan->inStride.size(); ++i)
+        auto& fftPlan = childNodes[0];
+        if(real_data_unit_stride())
         {
-            fftPlan->inStride[i] /= 2;
+            // iDist is in reals, subplan->iDist is in complexes
+
+            fftPlan->inStride = inStride;
+            for(int i = 1; i < fftPlan->inStride.size(); ++i)
+            {
+                fftPlan->inStride[i] /= 2;
+            }
+            fftPlan->iDist     = iDist / 2;
+            fftPlan->outStride = inStride;
+            for(int i = 1; i < fftPlan->outStride.size(); ++i)
+            {
+                fftPlan->outStride[i] /= 2;
+            }
+            fftPlan->oDist = iDist / 2;
         }
-        fftPlan->iDist     = iDist / 2;
-        fftPlan->outStride = inStride;
-        for(int i = 1; i < fftPlan->outStride.size(); ++i)
+        else
         {
-            fftPlan->outStride[i] /= 2;
+            // The input is read as planar complex data, so strides
+            // stay in reals; the output is contiguous.
+            fftPlan->inStride = inStride;
+            fftPlan->inStride[0] *= 2;
+            fftPlan->iDist = iDist;
+            fftPlan->outStride.assign(1, 1);
+            for(size_t i = 1; i < fftPlan->length.size(); ++i)
+            {
+                fftPlan->outStride.push_back(fftPlan->outStride[i - 1] * fftPlan->length[i - 1]);
+            }
+            fftPlan->oDist = fftPlan->outStride.back() * fftPlan->length.back();
         }
-        fftPlan->oDist = iDist / 2;
         fftPlan->TraverseTreeAssignParamsLogicA();
         assert(fftPlan->length.size() == fftPlan->inStride.size());
         assert(fftPlan->length.size() == fftPlan->outStride.size());
@@ -3062,12 +3485,8 @@ void TreeNode::assign_params_CS_REAL_TRANSFORM_EVEN()
         auto& postPlan = childNodes[1];
         assert(postPlan->scheme == CS_KERNEL_R_TO_CMPLX
                || postPlan->scheme == CS_KERNEL_R_TO_CMPLX_TRANSPOSE);
-        postPlan->inStride = inStride;
-        for(int i = 1; i < postPlan->inStride.size(); ++i)
-        {
-            postPlan->inStride[i] /= 2;
-        }
-        postPlan->iDist     = iDist / 2;
+        postPlan->inStride  = fftPlan->outStride;
+        postPlan->iDist     = fftPlan->oDist;
         postPlan->outStride = outStride;
         postPlan->oDist     = oDist;
 
@@ -3084,30 +3503,51 @@ void TreeNode::assign_params_CS_REAL_TRANSFORM_EVEN()
         assert(prePlan->scheme == CS_KERNEL_CMPLX_TO_R);
 
         prePlan->iDist = iDist;
-        prePlan->oDist = oDist / 2;
 
         // Strides are actually distances for multimensional transforms.
         // Only the first value is used, but we require dimension values.
-        prePlan->inStride  = inStride;
-        prePlan->outStride = outStride;
-        // Strides are in complex types
-        for(int i = 1; i < prePlan->outStride.size(); ++i)
-        {
-            prePlan->outStride[i] /= 2;
-        }
+        prePlan->inStride = inStride;
 
         auto& fftPlan = childNodes[1];
-        // Transform the strides from real to complex.
+        if(real_data_unit_stride())
+        {
+            prePlan->oDist     = oDist / 2;
+            prePlan->outStride = outStride;
+            // Strides are in complex types
+            for(int i = 1; i < prePlan->outStride.size(); ++i)
+            {
+                prePlan->outStride[i] /= 2;
+            }
 
-        fftPlan->inStride  = outStride;
-        fftPlan->iDist     = oDist / 2;
-        fftPlan->outStride = outStride;
-        fftPlan->oDist     = fftPlan->iDist;
-        // The strides must be translated from real to complex.
-        for(int i = 1; i < fftPlan->inStride.size(); ++i)
+            // Transform the strides from real to complex.
+
+            fftPlan->inStride  = outStride;
+            fftPlan->iDist     = oDist / 2;
+            fftPlan->outStride = outStride;
+            fftPlan->oDist     = fftPlan->iDist;
+            // The strides must be translated from real to complex.
+            for(int i = 1; i < fftPlan->inStride.size(); ++i)
+            {
+                fftPlan->inStride[i] /= 2;
+                fftPlan->outStride[i] /= 2;
+            }
+        }
+        else
         {
-            fftPlan->inStride[i] /= 2;
-            fftPlan->outStride[i] /= 2;
+            // The pre-processed data is contiguous; the output is
+            // written as planar complex data, so strides stay in reals.
+            prePlan->outStride.assign(1, 1);
+            for(size_t i = 1; i < prePlan->length.size(); ++i)
+            {
+                prePlan->outStride.push_back(prePlan->outStride[i - 1] * prePlan->length[i - 1]);
+            }
+            prePlan->oDist = prePlan->outStride.back() * prePlan->length.back();
+
+            fftPlan->inStride  = prePlan->outStride;
+            fftPlan->iDist     = prePlan->oDist;
+            fftPlan->outStride = outStride;
+            fftPlan->outStride[0] *= 2;
+            fftPlan->oDist = oDist;
         }
 
         fftPlan->TraverseTreeAssignParamsLogicA();
@@ -3923,8 +4363,23 @@ void TreeNode::assign_params_CS_REAL_TRANSFORM_PAIR()
     }
     else
     {
-        // TODO: implement
-        assert(false);
+        // The pack plan is complex-to-real: the output is two real arrays, laid out like the
+        // user output, holding the real and imaginary parts in planar format.
+        auto& pack = childNodes[0];
+        assert(pack->scheme == CS_KERNEL_PAIR_PACK);
+        pack->inStride  = inStride;
+        pack->iDist     = 2 * iDist;
+        pack->outStride = outStride;
+        pack->oDist     = 2 * oDist;
+
+        // A planar-to-planar c2c node, where the next batch (or dimension) holds the imaginary
+        // part.  Thus, strides and distances are real-value sized.
+        auto& cplan      = childNodes[1];
+        cplan->inStride  = outStride;
+        cplan->iDist     = 2 * oDist;
+        cplan->outStride = outStride;
+        cplan->oDist     = 2 * oDist;
+        cplan->TraverseTreeAssignParamsLogicA();
     }
 }
 
@@ -4041,6 +4496,11 @@ void TreeNode::assign_params_CS_3D_TRTRTR()
         trans_plan->outStride.push_back(trans_plan->outStride[0] * trans_plan->length[1]);
         trans_plan->outStride.push_back(trans_plan->outStride[1] * trans_plan->length[2]);
         trans_plan->oDist = trans_plan->outStride[2] * trans_plan->length[0];
+        for(size_t index = 3; index < length.size(); index++)
+        {
+            trans_plan->outStride.push_back(trans_plan->oDist);
+            trans_plan->oDist *= length[index];
+        }
 
         auto& row_plan     = childNodes[i + 1];
         row_plan->inStride = trans_plan->outStride;
@@ -4057,6 +4517,11 @@ void TreeNode::assign_params_CS_3D_TRTRTR()
             row_plan->outStride.push_back(row_plan->outStride[0] * row_plan->length[0]);
             row_plan->outStride.push_back(row_plan->outStride[1] * row_plan->length[1]);
             row_plan->oDist = row_plan->outStride[2] * row_plan->length[2];
+            for(size_t index = 3; index < length.size(); index++)
+            {
+                row_plan->outStride.push_back(row_plan->oDist);
+                row_plan->oDist *= length[index];
+            }
         }
         row_plan->TraverseTreeAssignParamsLogicA();
     }
@@ -4093,6 +4558,79 @@ void TreeNode::assign_params_CS_3D_RC_STRAIGHT()
     zPlan->oDist     = zPlan->iDist;
 }
 
+void TreeNode::assign_params_CS_ND_RTRT()
+{
+    assert(childNodes.size() == 4);
+
+    const size_t last = dimension - 1;
+
+    const size_t biggerDim  = std::max(length[0], length[last]);
+    const size_t smallerDim = std::min(length[0], length[last]);
+    const size_t padding
+        = ((smallerDim % 64 == 0) || (biggerDim % 64 == 0)) && (biggerDim >= 512) ? 64 : 0;
+
+    // B -> B
+    auto& subPlan = childNodes[0];
+    assert((subPlan->obOut == OB_USER_OUT) || (subPlan->obOut == OB_TEMP_CMPLX_FOR_REAL)
+           || (subPlan->obOut == OB_TEMP_BLUESTEIN));
+    subPlan->inStride = inStride;
+    subPlan->iDist    = iDist;
+
+    subPlan->outStride = outStride;
+    subPlan->oDist     = oDist;
+
+    subPlan->TraverseTreeAssignParamsLogicA();
+
+    // B -> T
+    auto& trans1Plan = childNodes[1];
+    assert(trans1Plan->obOut == OB_TEMP);
+    trans1Plan->inStride.push_back(subPlan->outStride[0]);
+    trans1Plan->inStride.push_back(subPlan->outStride[last]);
+    for(size_t index = 1; index < length.size(); index++)
+    {
+        if(index != last)
+            trans1Plan->inStride.push_back(subPlan->outStride[index]);
+    }
+    trans1Plan->iDist = subPlan->oDist;
+
+    trans1Plan->outStride.push_back(1);
+    trans1Plan->outStride.push_back(trans1Plan->length[1] + padding);
+    trans1Plan->oDist = trans1Plan->length[0] * trans1Plan->outStride[1];
+
+    for(size_t index = 2; index < trans1Plan->length.size(); index++)
+    {
+        trans1Plan->outStride.push_back(trans1Plan->oDist);
+        trans1Plan->oDist *= trans1Plan->length[index];
+    }
+
+    // T -> T
+    auto& rowPlan = childNodes[2];
+    assert(rowPlan->obOut == OB_TEMP);
+    rowPlan->inStride = trans1Plan->outStride;
+    rowPlan->iDist    = trans1Plan->oDist;
+
+    rowPlan->outStride = rowPlan->inStride;
+    rowPlan->oDist     = rowPlan->iDist;
+
+    rowPlan->TraverseTreeAssignParamsLogicA();
+
+    // T -> B
+    auto& trans2Plan = childNodes[3];
+    assert((trans2Plan->obOut == OB_USER_OUT) || (trans2Plan->obOut == OB_TEMP_CMPLX_FOR_REAL)
+           || (trans2Plan->obOut == OB_TEMP_BLUESTEIN));
+    trans2Plan->inStride = rowPlan->outStride;
+    trans2Plan->iDist    = rowPlan->oDist;
+
+    trans2Plan->outStride.push_back(outStride[0]);
+    trans2Plan->outStride.push_back(outStride[last]);
+    for(size_t index = 1; index < length.size(); index++)
+    {
+        if(index != last)
+            trans2Plan->outStride.push_back(outStride[index]);
+    }
+    trans2Plan->oDist = oDist;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// Collect leaf node and calculate work memory requirements
 
@@ -18,6 +18,7 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 // THE SOFTWARE.
 
+#include <algorithm>
 #include <atomic>
 #include <cassert>
 #include <cstddef>
@@ -36,6 +37,8 @@
 #include "radix_table.h"
 
 #include "kernel_launch.h"
+#include "kernel_profiler.h"
+#include "launch_graph.h"
 
 #include "function_pool.h"
 #include "ref_cpu.h"
@@ -51,44 +54,307 @@
 
 std::atomic<bool> fn_checked(false);
 
-// This function is called during creation of plan: enqueue the HIP kernels by function
-// pointers. Return true if everything goes well. Any internal device memory allocation
-// failure returns false right away.
-bool PlanPowX(ExecPlan& execPlan)
+// Base pointer of a user buffer, for the given planar component.
+static LaunchBuffer UserLaunchBuffer(OperatingBuffer ob, size_t component)
 {
-    for(const auto& node : execPlan.execSeq)
+    switch(ob)
+    {
+    case OB_USER_IN:
+        return component == 0 ? LB_USER_IN0 : LB_USER_IN1;
+    case OB_USER_OUT:
+        return component == 0 ? LB_USER_OUT0 : LB_USER_OUT1;
+    default:
+        assert(false);
+        return LB_NONE;
+    }
+}
+
+static bool IsPlanar(rocfft_array_type type)
+{
+    return type == rocfft_array_type_complex_planar || type == rocfft_array_type_hermitian_planar;
+}
+
+// Resolve the operating buffer of a node to a launch buffer, for the
+// typical case where planar data in the work buffer is split in half.
+static LaunchBufferRef NodeLaunchBuffer(const ExecPlan&   execPlan,
+                                        const TreeNode*   node,
+                                        OperatingBuffer   ob,
+                                        rocfft_array_type type,
+                                        size_t            blueOffset,
+                                        size_t            component)
+{
+    // Size of complex type
+    const size_t complexTSize
+        = (node->precision == rocfft_precision_single) ? sizeof(float) * 2 : sizeof(double) * 2;
+
+    LaunchBufferRef ref;
+    if(component == 1 && !IsPlanar(type))
+        return ref;
+
+    switch(ob)
     {
-        if((node->scheme == CS_KERNEL_STOCKHAM) || (node->scheme == CS_KERNEL_STOCKHAM_BLOCK_CC)
-           || (node->scheme == CS_KERNEL_STOCKHAM_BLOCK_RC))
+    case OB_USER_IN:
+    case OB_USER_OUT:
+        ref.base = UserLaunchBuffer(ob, component);
+        break;
+    case OB_TEMP:
+        ref.base = LB_WORK;
+        // Assume planar using the same extra size of memory as
+        // interleaved format, and we just need to split it for
+        // planar.
+        if(component == 1)
+            ref.offset = execPlan.workBufSize * complexTSize / 2;
+        break;
+    case OB_TEMP_CMPLX_FOR_REAL:
+        if(component == 0)
         {
-            node->twiddles = twiddles_create(node->length[0], node->precision, false, false);
-            if(node->twiddles == nullptr)
-                return false;
+            ref.base   = LB_WORK;
+            ref.offset = execPlan.tmpWorkBufSize * complexTSize;
         }
-        else if((node->scheme == CS_KERNEL_R_TO_CMPLX)
-                || (node->scheme == CS_KERNEL_R_TO_CMPLX_TRANSPOSE)
-                || (node->scheme == CS_KERNEL_CMPLX_TO_R))
+        break;
+    case OB_TEMP_BLUESTEIN:
+        if(component == 0)
         {
-            node->twiddles = twiddles_create(2 * node->length[0], node->precision, false, true);
-            if(node->twiddles == nullptr)
-                return false;
+            ref.base   = LB_WORK;
+            ref.offset = (execPlan.tmpWorkBufSize + execPlan.copyWorkBufSize + blueOffset)
+                         * complexTSize;
         }
-        // need twiddles of the lowest dimension after the transpose is done
-        else if(node->scheme == CS_KERNEL_TRANSPOSE_CMPLX_TO_R)
+        break;
+    case OB_UNINIT:
+        rocfft_cerr << "Error: operating buffer not initialized for kernel!\n";
+        assert(ob != OB_UNINIT);
+    default:
+        rocfft_cerr << "Error: operating buffer not specified for kernel!\n";
+        assert(false);
+    }
+    return ref;
+}
+
+// Precompute the function, grid and buffer locations of every
+// kernel, so that executing the plan does not need to look at the
+// operating buffers and array types of each node again.
+static void PlanLaunchTable(ExecPlan& execPlan)
+{
+    execPlan.launchTable.clear();
+    for(size_t i = 0; i < execPlan.execSeq.size(); i++)
+    {
+        LaunchEntry entry;
+        entry.node      = execPlan.execSeq[i];
+        entry.fn        = execPlan.devFnCall[i];
+        entry.gridParam = execPlan.gridParam[i];
+
+        const TreeNode* node = entry.node;
+
+        // Size of complex type
+        const size_t complexTSize = (node->precision == rocfft_precision_single)
+                                        ? sizeof(float) * 2
+                                        : sizeof(double) * 2;
+        // Size of real type
+        const size_t realTSize = complexTSize / 2;
+
+        if(node->parent != NULL && node->parent->scheme == CS_REAL_TRANSFORM_PAIR)
         {
-            // C2R transform ends up getting shorter by 1 along that dimension also
-            node->twiddles
-                = twiddles_create(2 * (node->length.back() - 1), node->precision, false, true);
-            if(node->twiddles == nullptr)
-                return false;
+            // We conclude that we are performing real/complex paired transform, where the real
+            // values are treated as the real and complex parts of a complex/complex transform in
+            // planar format.
+
+            if(node->scheme == CS_KERNEL_PAIR_UNPACK)
+            {
+                // This node is the unpack plan.
+                assert(node->obIn == OB_USER_IN || node->obIn == OB_TEMP);
+                entry.bufIn[0]
+                    = NodeLaunchBuffer(execPlan, node, node->obIn, node->inArrayType, 0, 0);
+
+                assert(node->obOut == OB_USER_OUT);
+                entry.bufOut[0]
+                    = NodeLaunchBuffer(execPlan, node, node->obOut, node->outArrayType, 0, 0);
+                entry.bufOut[1]
+                    = NodeLaunchBuffer(execPlan, node, node->obOut, node->outArrayType, 0, 1);
+            }
+            else if(node->scheme == CS_KERNEL_PAIR_PACK)
+            {
+                // This node is the pack plan.
+                assert(node->obIn == OB_USER_IN || node->obIn == OB_USER_OUT);
+                entry.bufIn[0]
+                    = NodeLaunchBuffer(execPlan, node, node->obIn, node->inArrayType, 0, 0);
+                entry.bufIn[1]
+                    = NodeLaunchBuffer(execPlan, node, node->obIn, node->inArrayType, 0, 1);
+
+                assert(node->obOut == OB_USER_OUT || node->obOut == OB_TEMP);
+                entry.bufOut[0]
+                    = NodeLaunchBuffer(execPlan, node, node->obOut, node->outArrayType, 0, 0);
+            }
+            else
+            {
+                // We infer that this node is the real-as-planar c2c transform.
+
+                // TODO: deal with multiple kernels.
+
+                // Calculate the pointer to the planar format when using the paired
+                // real/complex method.
+                // The real-valued side of the transform is the input for
+                // forward transforms and the output for inverse transforms.
+                const auto& realStride = (node->direction == -1) ? execPlan.rootPlan->inStride
+                                                                 : execPlan.rootPlan->outStride;
+                const size_t ioffset = (execPlan.rootPlan->batch % 2 == 0)
+                                           ? realTSize * node->iDist / 2
+                                           : realTSize * realStride[node->pairdim];
+                assert(ioffset != 0);
+
+                assert(node->obIn == OB_USER_IN || node->obIn == OB_USER_OUT
+                       || node->obIn == OB_TEMP);
+                entry.bufIn[0] = NodeLaunchBuffer(
+                    execPlan, node, node->obIn, rocfft_array_type_complex_interleaved, 0, 0);
+                entry.bufIn[1] = entry.bufIn[0];
+                entry.bufIn[1].offset += ioffset;
+
+                switch(node->obOut)
+                {
+                case OB_USER_IN:
+                    entry.bufOut[0] = entry.bufIn[0];
+                    break;
+                case OB_USER_OUT:
+                case OB_TEMP:
+                    entry.bufOut[0] = NodeLaunchBuffer(
+                        execPlan, node, node->obOut, rocfft_array_type_complex_interleaved, 0, 0);
+                    break;
+                default:
+                    rocfft_cerr << "Error: operating buffer not specified for kernel!\n";
+                    assert(false);
+                }
+                entry.bufOut[1] = entry.bufOut[0];
+                entry.bufOut[1].offset += ioffset;
+            }
+        }
+        else if(node->parent != NULL && node->parent->scheme == CS_REAL_TRANSFORM_EVEN
+                && (node->inArrayType == rocfft_array_type_complex_planar
+                    || node->outArrayType == rocfft_array_type_complex_planar))
+        {
+            // This node is the c2c transform of an even-length real
+            // transform with non-unit real stride.  The real data is
+            // treated as planar complex data, where the imaginary parts
+            // are one real element after the real parts.
+            if(node->direction == -1)
+            {
+                assert(node->obIn == OB_USER_IN || node->obIn == OB_USER_OUT);
+                entry.bufIn[0].base = UserLaunchBuffer(node->obIn, 0);
+                entry.bufIn[1]      = entry.bufIn[0];
+                entry.bufIn[1].offset += realTSize * node->inStride[0] / 2;
+
+                assert(node->obOut == OB_TEMP_CMPLX_FOR_REAL);
+                entry.bufOut[0] = NodeLaunchBuffer(
+                    execPlan, node, node->obOut, rocfft_array_type_complex_interleaved, 0, 0);
+            }
+            else
+            {
+                assert(node->obIn == OB_TEMP_CMPLX_FOR_REAL);
+                entry.bufIn[0] = NodeLaunchBuffer(
+                    execPlan, node, node->obIn, rocfft_array_type_complex_interleaved, 0, 0);
+
+                assert(node->obOut == OB_USER_IN || node->obOut == OB_USER_OUT);
+                entry.bufOut[0].base = UserLaunchBuffer(node->obOut, 0);
+                entry.bufOut[1]      = entry.bufOut[0];
+                entry.bufOut[1].offset += realTSize * node->outStride[0] / 2;
+            }
+        }
+        else
+        {
+            // Typical case.
+            for(size_t component = 0; component < 2; ++component)
+            {
+                entry.bufIn[component] = NodeLaunchBuffer(
+                    execPlan, node, node->obIn, node->inArrayType, node->iOffset, component);
+                entry.bufOut[component] = NodeLaunchBuffer(
+                    execPlan, node, node->obOut, node->outArrayType, node->oOffset, component);
+            }
         }
-        else if(node->scheme == CS_KERNEL_2D_SINGLE)
+
+        execPlan.launchTable.push_back(entry);
+    }
+}
+
+// Twiddles and kernel arguments only depend on the lengths, strides
+// and distances of a node, so they carry over between plans whose
+// trees only differ in batch count.
+static bool SameDeviceBuffers(const TreeNode& a, const TreeNode& b)
+{
+    return a.scheme == b.scheme && a.precision == b.precision && a.length == b.length
+           && a.inStride == b.inStride && a.outStride == b.outStride && a.iDist == b.iDist
+           && a.oDist == b.oDist && a.large1D == b.large1D;
+}
+
+void MoveDeviceBuffers(ExecPlan& from, ExecPlan& to)
+{
+    if(from.execSeq.size() != to.execSeq.size())
+        return;
+    for(size_t i = 0; i < from.execSeq.size(); ++i)
+    {
+        TreeNode* src = from.execSeq[i];
+        TreeNode* dst = to.execSeq[i];
+        if(!SameDeviceBuffers(*src, *dst))
+            continue;
+        std::swap(dst->twiddles, src->twiddles);
+        std::swap(dst->twiddles_large, src->twiddles_large);
+        std::swap(dst->devKernArg, src->devKernArg);
+    }
+}
+
+// This function is called during creation of plan: enqueue the HIP kernels by function
+// pointers. Return true if everything goes well. Any internal device memory allocation
+// failure returns false right away.
+bool PlanPowX(ExecPlan& execPlan)
+{
+    for(const auto& node : execPlan.execSeq)
+    {
+        // twiddles may have been taken over from a plan with a
+        // different batch count
+        if(node->twiddles == nullptr)
         {
-            // create one set of twiddles for each dimension
-            node->twiddles = twiddles_create_2D(node->length[0], node->length[1], node->precision);
+            if((node->scheme == CS_KERNEL_STOCKHAM)
+               || (node->scheme == CS_KERNEL_STOCKHAM_BLOCK_CC)
+               || (node->scheme == CS_KERNEL_STOCKHAM_BLOCK_RC)
+               || (node->scheme == CS_KERNEL_STOCKHAM_REAL))
+            {
+                node->twiddles = twiddles_create(node->length[0], node->precision, false, false);
+                if(node->twiddles == nullptr)
+                    return false;
+            }
+            else if((node->scheme == CS_KERNEL_R_TO_CMPLX)
+                    || (node->scheme == CS_KERNEL_R_TO_CMPLX_TRANSPOSE)
+                    || (node->scheme == CS_KERNEL_CMPLX_TO_R))
+            {
+                node->twiddles
+                    = twiddles_create(2 * node->length[0], node->precision, false, true);
+                if(node->twiddles == nullptr)
+                    return false;
+            }
+            // need twiddles of the lowest dimension after the transpose is done
+            else if(node->scheme == CS_KERNEL_TRANSPOSE_CMPLX_TO_R)
+            {
+                // C2R transform ends up getting shorter by 1 along that dimension also
+                node->twiddles
+                    = twiddles_create(2 * (node->length.back() - 1), node->precision, false, true);
+                if(node->twiddles == nullptr)
+                    return false;
+            }
+            else if(node->scheme == CS_KERNEL_2D_SINGLE)
+            {
+                // create one set of twiddles for each dimension
+                node->twiddles
+                    = twiddles_create_2D(node->length[0], node->length[1], node->precision);
+            }
+            else if(node->scheme == CS_KERNEL_2D_SINGLE_REAL)
+            {
+                // row and column twiddles, followed by the real
+                // post/pre-processing twiddles
+                node->twiddles
+                    = twiddles_create_2D_real(node->length[0], node->length[1], node->precision);
+                if(node->twiddles == nullptr)
+                    return false;
+            }
         }
 
-        if(node->large1D != 0)
+        if(node->large1D != 0 && node->twiddles_large == nullptr)
         {
             node->twiddles_large = twiddles_create(node->large1D, node->precision, true, false);
             if(node->twiddles_large == nullptr)
@@ -98,6 +364,8 @@ bool PlanPowX(ExecPlan& execPlan)
     // copy host buffer to device buffer
     for(size_t i = 0; i < execPlan.execSeq.size(); i++)
     {
+        if(execPlan.execSeq[i]->devKernArg != nullptr)
+            continue;
         execPlan.execSeq[i]->devKernArg = kargs_create(execPlan.execSeq[i]->length,
                                                        execPlan.execSeq[i]->inStride,
                                                        execPlan.execSeq[i]->outStride,
@@ -117,16 +385,19 @@ bool PlanPowX(ExecPlan& execPlan)
     {
         DevFnCall ptr = nullptr;
         GridParam gp;
-        size_t    bwd, wgs, lds;
+        size_t    bwd, wgs;
 
         switch(execPlan.execSeq[i]->scheme)
         {
         case CS_KERNEL_STOCKHAM:
         {
             // get working group size and number of transforms
-            size_t workGroupSize;
-            size_t numTransforms;
-            GetWGSAndNT(execPlan.execSeq[i]->length[0], workGroupSize, numTransforms);
+            const auto& metadata = function_pool::get_metadata(
+                execPlan.execSeq[0]->precision,
+                std::make_pair(execPlan.execSeq[i]->length[0], CS_KERNEL_STOCKHAM));
+            size_t workGroupSize = metadata.workGroupSize;
+            size_t numTransforms = metadata.transforms;
+
             ptr          = (execPlan.execSeq[0]->precision == rocfft_precision_single)
                                ? function_pool::get_function_single(
                           std::make_pair(execPlan.execSeq[i]->length[0], CS_KERNEL_STOCKHAM))
@@ -140,13 +411,41 @@ bool PlanPowX(ExecPlan& execPlan)
             gp.tpb_x = workGroupSize;
         }
         break;
+        case CS_KERNEL_STOCKHAM_REAL:
+        {
+            // same threadblock shape as the complex kernel of this length
+            const auto& metadata = function_pool::get_metadata(
+                execPlan.execSeq[0]->precision,
+                std::make_pair(execPlan.execSeq[i]->length[0], CS_KERNEL_STOCKHAM_REAL));
+            size_t workGroupSize = metadata.workGroupSize;
+            size_t numTransforms = metadata.transforms;
+
+            ptr          = (execPlan.execSeq[0]->precision == rocfft_precision_single)
+                               ? function_pool::get_function_single(std::make_pair(
+                          execPlan.execSeq[i]->length[0], CS_KERNEL_STOCKHAM_REAL))
+                               : function_pool::get_function_double(std::make_pair(
+                          execPlan.execSeq[i]->length[0], CS_KERNEL_STOCKHAM_REAL));
+            size_t batch = execPlan.execSeq[i]->batch;
+            for(size_t j = 1; j < execPlan.execSeq[i]->length.size(); j++)
+                batch *= execPlan.execSeq[i]->length[j];
+            gp.b_x
+                = (batch % numTransforms) ? 1 + (batch / numTransforms) : (batch / numTransforms);
+            gp.tpb_x = workGroupSize;
+        }
+        break;
         case CS_KERNEL_STOCKHAM_BLOCK_CC:
             ptr = (execPlan.execSeq[0]->precision == rocfft_precision_single)
                       ? function_pool::get_function_single(std::make_pair(
                           execPlan.execSeq[i]->length[0], CS_KERNEL_STOCKHAM_BLOCK_CC))
                       : function_pool::get_function_double(std::make_pair(
                           execPlan.execSeq[i]->length[0], CS_KERNEL_STOCKHAM_BLOCK_CC));
-            GetBlockComputeTable(execPlan.execSeq[i]->length[0], bwd, wgs, lds);
+            {
+                const auto& metadata = function_pool::get_metadata(
+                    execPlan.execSeq[0]->precision,
+                    std::make_pair(execPlan.execSeq[i]->length[0], CS_KERNEL_STOCKHAM_BLOCK_CC));
+                bwd = metadata.transforms;
+                wgs = metadata.workGroupSize;
+            }
             gp.b_x = (execPlan.execSeq[i]->length[1]) / bwd;
             // repeat for higher dimensions + batch
             gp.b_x *= std::accumulate(execPlan.execSeq[i]->length.begin() + 2,
@@ -161,7 +460,13 @@ bool PlanPowX(ExecPlan& execPlan)
                           execPlan.execSeq[i]->length[0], CS_KERNEL_STOCKHAM_BLOCK_RC))
                       : function_pool::get_function_double(std::make_pair(
                           execPlan.execSeq[i]->length[0], CS_KERNEL_STOCKHAM_BLOCK_RC));
-            GetBlockComputeTable(execPlan.execSeq[i]->length[0], bwd, wgs, lds);
+            {
+                const auto& metadata = function_pool::get_metadata(
+                    execPlan.execSeq[0]->precision,
+                    std::make_pair(execPlan.execSeq[i]->length[0], CS_KERNEL_STOCKHAM_BLOCK_RC));
+                bwd = metadata.transforms;
+                wgs = metadata.workGroupSize;
+            }
             gp.b_x = (execPlan.execSeq[i]->length[1]) / bwd;
             // repeat for higher dimensions + batch
             gp.b_x *= std::accumulate(execPlan.execSeq[i]->length.begin() + 2,
@@ -256,13 +561,40 @@ bool PlanPowX(ExecPlan& execPlan)
             // boundaries, or else we are unable to make the row
             // transform finish completely before starting the column
             // transform.
-            gp.b_x = execPlan.execSeq[i]->batch;
-            // if we're doing 3D transform, we need to repeat the 2D
-            // transform in the 3rd dimension
-            if(execPlan.execSeq[i]->length.size() > 2)
-                gp.b_x *= execPlan.execSeq[i]->length[2];
-            gp.tpb_x = Get2DSingleThreadCount(
-                execPlan.execSeq[i]->length[0], execPlan.execSeq[i]->length[1], GetWGSAndNT);
+            // if we're doing a 3D or higher transform, we need to
+            // repeat the 2D transform in the higher dimensions
+            gp.b_x = std::accumulate(execPlan.execSeq[i]->length.begin() + 2,
+                                     execPlan.execSeq[i]->length.end(),
+                                     execPlan.execSeq[i]->batch,
+                                     std::multiplies<size_t>());
+            gp.tpb_x = function_pool::get_metadata_2D(
+                           execPlan.execSeq[0]->precision,
+                           std::make_tuple(execPlan.execSeq[i]->length[0],
+                                           execPlan.execSeq[i]->length[1],
+                                           CS_KERNEL_2D_SINGLE))
+                           .workGroupSize;
+            break;
+        }
+        case CS_KERNEL_2D_SINGLE_REAL:
+        {
+            ptr = (execPlan.execSeq[0]->precision == rocfft_precision_single)
+                      ? function_pool::get_function_single_2D(
+                          std::make_tuple(execPlan.execSeq[i]->length[0],
+                                          execPlan.execSeq[i]->length[1],
+                                          CS_KERNEL_2D_SINGLE_REAL))
+                      : function_pool::get_function_double_2D(
+                          std::make_tuple(execPlan.execSeq[i]->length[0],
+                                          execPlan.execSeq[i]->length[1],
+                                          CS_KERNEL_2D_SINGLE_REAL));
+            // one threadblock per 2D transform, as for the complex
+            // 2D_SINGLE kernels
+            gp.b_x   = execPlan.execSeq[i]->batch;
+            gp.tpb_x = function_pool::get_metadata_2D(
+                           execPlan.execSeq[0]->precision,
+                           std::make_tuple(execPlan.execSeq[i]->length[0],
+                                           execPlan.execSeq[i]->length[1],
+                                           CS_KERNEL_2D_SINGLE_REAL))
+                           .workGroupSize;
             break;
         }
         default:
@@ -275,9 +607,87 @@ bool PlanPowX(ExecPlan& execPlan)
         execPlan.gridParam.push_back(gp);
     }
 
+    PlanLaunchTable(execPlan);
+    execPlan.launchGraphs = std::make_shared<LaunchGraphCache>(execPlan);
+
     return true;
 }
 
+// Whether a launch entry is a complex interleaved Stockham kernel
+// that has a callback variant, and reads (or writes) the given user
+// buffer from its start.
+static bool CallbackEntry(const LaunchEntry&               entry,
+                          const LaunchBufferRef&           ref,
+                          const std::vector<LaunchBuffer>& bases)
+{
+    const TreeNode* node = entry.node;
+    if(node->scheme != CS_KERNEL_STOCKHAM || node->batchPointers
+       || node->inArrayType != rocfft_array_type_complex_interleaved
+       || node->outArrayType != rocfft_array_type_complex_interleaved)
+        return false;
+    if(std::find(bases.begin(), bases.end(), ref.base) == bases.end() || ref.offset != 0)
+        return false;
+    return function_pool::get_callback_function(
+               node->precision, std::make_pair(node->length[0], CS_KERNEL_STOCKHAM))
+           != nullptr;
+}
+
+// Apply user load/store callbacks to a plan.  The load callback is
+// done by the first kernel, which must read the user's input, and
+// the store callback by the last kernel, which must write the user's
+// output.  Entries with callbacks are switched to the callback
+// variants of their kernels.
+rocfft_status SetPlanCallbacks(ExecPlan& execPlan, const UserCallbacks& callbacks)
+{
+    if(execPlan.launchTable.empty())
+        return rocfft_status_failure;
+
+    const TreeNode* root    = execPlan.rootPlan.get();
+    const bool      inplace = root->placement == rocfft_placement_inplace;
+    LaunchEntry&    first   = execPlan.launchTable.front();
+    LaunchEntry&    last    = execPlan.launchTable.back();
+
+    if(callbacks.load_fn != nullptr
+       && (root->inArrayType != rocfft_array_type_complex_interleaved
+           || !CallbackEntry(first, first.bufIn[0], {LB_USER_IN0})))
+        return rocfft_status_invalid_arg_value;
+    if(callbacks.store_fn != nullptr
+       && (root->outArrayType != rocfft_array_type_complex_interleaved
+           || !CallbackEntry(last,
+                             last.bufOut[0],
+                             inplace ? std::vector<LaunchBuffer>{LB_USER_IN0, LB_USER_OUT0}
+                                     : std::vector<LaunchBuffer>{LB_USER_OUT0})))
+        return rocfft_status_invalid_arg_value;
+
+    for(size_t i = 0; i < execPlan.launchTable.size(); ++i)
+    {
+        LaunchEntry& entry = execPlan.launchTable[i];
+        entry.callbacks    = UserCallbacks();
+        if(i == 0)
+        {
+            entry.callbacks.load_fn   = callbacks.load_fn;
+            entry.callbacks.load_data = callbacks.load_data;
+        }
+        if(i + 1 == execPlan.launchTable.size())
+        {
+            entry.callbacks.store_fn   = callbacks.store_fn;
+            entry.callbacks.store_data = callbacks.store_data;
+        }
+
+        if(entry.callbacks.load_fn == nullptr && entry.callbacks.store_fn == nullptr)
+            entry.fn = execPlan.devFnCall[i];
+        else
+            entry.fn = function_pool::get_callback_function(
+                entry.node->precision, std::make_pair(entry.node->length[0], CS_KERNEL_STOCKHAM));
+    }
+    execPlan.callbacks = callbacks;
+
+    // launch graphs are shared between copies of the ExecPlan, and
+    // were recorded with the previous kernels
+    execPlan.launchGraphs = std::make_shared<LaunchGraphCache>(execPlan);
+    return rocfft_status_success;
+}
+
 static size_t data_size_bytes(const std::vector<size_t>& lengths,
                               rocfft_precision           precision,
                               rocfft_array_type          type)
@@ -310,12 +720,6 @@ static size_t data_size_bytes(const std::vector<size_t>& lengths,
     }
 }
 
-static float execution_bandwidth_GB_per_s(size_t data_size_bytes, float duration_ms)
-{
-    // divide bytes by (1000000 * milliseconds) to get GB/s
-    return static_cast<float>(data_size_bytes) / (1000000.0 * duration_ms);
-}
-
 // NOTE: HIP returns the maximum global frequency in kHz, which might
 // not be the actual frequency when the transform ran.  This function
 // might also return 0.0 if the bandwidth can't be queried.
@@ -335,231 +739,73 @@ static float max_memory_bandwidth_GB_per_s()
     return result;
 }
 
+// Substitute the caller's pointers into a precomputed launch buffer.
+static inline void* ResolveLaunchBuffer(const LaunchBufferRef& ref,
+                                        void*                  in_buffer[],
+                                        void*                  out_buffer[],
+                                        void*                  work_buffer)
+{
+    char* base = nullptr;
+    switch(ref.base)
+    {
+    case LB_NONE:
+        return nullptr;
+    case LB_USER_IN0:
+        base = (char*)in_buffer[0];
+        break;
+    case LB_USER_IN1:
+        base = (char*)in_buffer[1];
+        break;
+    case LB_USER_OUT0:
+        base = (char*)out_buffer[0];
+        break;
+    case LB_USER_OUT1:
+        base = (char*)out_buffer[1];
+        break;
+    case LB_WORK:
+        base = (char*)work_buffer;
+        break;
+    }
+    return (void*)(base + ref.offset);
+}
+
 // Internal plan executor.
 // For in-place transforms, in_buffer == out_buffer.
 void TransformPowX(const ExecPlan&       execPlan,
                    void*                 in_buffer[],
                    void*                 out_buffer[],
-                   rocfft_execution_info info)
+                   void*                 work_buffer,
+                   rocfft_execution_info info,
+                   hipEvent_t*           kernel_events)
 {
-    assert(execPlan.execSeq.size() == execPlan.devFnCall.size());
-    assert(execPlan.execSeq.size() == execPlan.gridParam.size());
-
-    // we can log profile information if we're on the null stream,
-    // since we will be able to wait for the transform to finish
-    bool       emit_profile_log = LOG_PROFILE_ENABLED() && !info->rocfft_stream;
-    float      max_memory_bw    = 0.0;
-    hipEvent_t start, stop;
+    assert(execPlan.execSeq.size() == execPlan.launchTable.size());
+
+    // kernels are timed with events on the stream they run on, and
+    // logged once they have finished
+    bool  emit_profile_log = LOG_PROFILE_ENABLED();
+    float max_memory_bw    = 0.0;
     if(emit_profile_log)
     {
-        hipEventCreate(&start);
-        hipEventCreate(&stop);
+        // log kernels from earlier executions that are done by now
+        KernelProfiler::GetProfiler().Harvest(false);
         max_memory_bw = max_memory_bandwidth_GB_per_s();
     }
-    for(size_t i = 0; i < execPlan.execSeq.size(); i++)
+    for(size_t i = 0; i < execPlan.launchTable.size(); i++)
     {
+        const LaunchEntry& entry = execPlan.launchTable[i];
+
         DeviceCallIn data;
-        data.node          = execPlan.execSeq[i];
+        data.node          = entry.node;
         data.rocfft_stream = (info == nullptr) ? 0 : info->rocfft_stream;
-
-        // Size of complex type
-        const size_t complexTSize = (data.node->precision == rocfft_precision_single)
-                                        ? sizeof(float) * 2
-                                        : sizeof(double) * 2;
-
-        if(data.node->parent != NULL && data.node->parent->scheme == CS_REAL_TRANSFORM_PAIR)
-        {
-            // We conclude that we are performing real/complex paired transform, where the real
-            // values are treated as the real and complex parts of a complex/complex transform in
-            // planar format.
-
-            // We have only implemented forward transforms: TODO: enable inverse.
-            assert(data.node->direction == -1);
-
-            if(data.node->scheme == CS_KERNEL_PAIR_UNPACK)
-            {
-                // Tthis node is the unpack plan.
-                switch(data.node->obIn)
-                {
-                case OB_USER_IN:
-                    data.bufIn[0] = in_buffer[0];
-                    break;
-                case OB_TEMP:
-                    data.bufIn[0] = info->workBuffer;
-                    break;
-                default:
-                    rocfft_cerr << "Error: operating buffer not specified for kernel!\n";
-                    assert(false);
-                }
-
-                switch(data.node->obOut)
-                {
-                case OB_USER_OUT:
-                    data.bufOut[0] = out_buffer[0];
-                    if(data.node->outArrayType == rocfft_array_type_hermitian_planar)
-                    {
-                        data.bufOut[1] = out_buffer[1];
-                    }
-                    break;
-                default:
-                    rocfft_cerr << "Error: operating buffer not specified for kernel!\n";
-                    assert(false);
-                }
-            }
-            else
-            {
-                // We infer that this node is the real-as-planar c2c transform.
-
-                // TODO: deal with multiple kernels.
-
-                assert(data.node->scheme != CS_KERNEL_PAIR_UNPACK);
-
-                // Size of real type
-                const size_t realTSize = (data.node->precision == rocfft_precision_single)
-                                             ? sizeof(float)
-                                             : sizeof(double);
-
-                // Calculate the pointer to the planar format when using the paired
-                // real/complex method.
-                const ptrdiff_t ioffset
-                    = (execPlan.rootPlan->batch % 2 == 0)
-                          ? realTSize * data.node->iDist / 2
-                          : realTSize * execPlan.rootPlan->inStride[data.node->pairdim];
-                assert(ioffset != 0);
-                // std::cout << "ioffset: " << ioffset << std::endl;
-
-                switch(data.node->obIn)
-                {
-                case OB_USER_IN:
-                    data.bufIn[0] = in_buffer[0];
-                    break;
-                case OB_USER_OUT:
-                    data.bufIn[0] = out_buffer[0];
-                    break;
-                default:
-                    rocfft_cerr << "Error: operating buffer not specified for kernel!\n";
-                    assert(false);
-                }
-                data.bufIn[1] = (void*)((char*)data.bufIn[0] + ioffset);
-
-                switch(data.node->obOut)
-                {
-                case OB_USER_IN:
-                    data.bufOut[0] = data.bufIn[0];
-                    data.bufOut[1] = data.bufIn[1];
-                    break;
-                case OB_USER_OUT:
-                    data.bufOut[0] = out_buffer[0];
-                    break;
-                case OB_TEMP:
-                    data.bufOut[0] = info->workBuffer;
-                    break;
-                default:
-                    rocfft_cerr << "Error: operating buffer not specified for kernel!\n";
-                    assert(false);
-                }
-                data.bufOut[1] = (void*)((char*)data.bufOut[0] + ioffset);
-            }
-        }
-        else
+        data.gridParam     = entry.gridParam;
+        data.callbacks     = entry.callbacks;
+        for(size_t j = 0; j < 2; ++j)
         {
-            // Typical case.
-
-            switch(data.node->obIn)
-            {
-            case OB_USER_IN:
-                data.bufIn[0] = in_buffer[0];
-                if(data.node->inArrayType == rocfft_array_type_complex_planar
-                   || data.node->inArrayType == rocfft_array_type_hermitian_planar)
-                {
-                    data.bufIn[1] = in_buffer[1];
-                }
-                break;
-            case OB_USER_OUT:
-                data.bufIn[0] = out_buffer[0];
-                if(data.node->inArrayType == rocfft_array_type_complex_planar
-                   || data.node->inArrayType == rocfft_array_type_hermitian_planar)
-                {
-                    data.bufIn[1] = out_buffer[1];
-                }
-                break;
-            case OB_TEMP:
-                data.bufIn[0] = info->workBuffer;
-                if(data.node->inArrayType == rocfft_array_type_complex_planar
-                   || data.node->inArrayType == rocfft_array_type_hermitian_planar)
-                {
-                    // Assume planar using the same extra size of memory as
-                    // interleaved format, and we just need to split it for
-                    // planar.
-                    data.bufIn[1] = (void*)((char*)info->workBuffer
-                                            + execPlan.workBufSize * complexTSize / 2);
-                }
-                break;
-            case OB_TEMP_CMPLX_FOR_REAL:
-                data.bufIn[0]
-                    = (void*)((char*)info->workBuffer + execPlan.tmpWorkBufSize * complexTSize);
-                break;
-            case OB_TEMP_BLUESTEIN:
-                data.bufIn[0] = (void*)((char*)info->workBuffer
-                                        + (execPlan.tmpWorkBufSize + execPlan.copyWorkBufSize
-                                           + data.node->iOffset)
-                                              * complexTSize);
-                break;
-            case OB_UNINIT:
-                rocfft_cerr << "Error: operating buffer not initialized for kernel!\n";
-                assert(data.node->obIn != OB_UNINIT);
-            default:
-                rocfft_cerr << "Error: operating buffer not specified for kernel!\n";
-                assert(false);
-            }
-
-            switch(data.node->obOut)
-            {
-            case OB_USER_IN:
-                data.bufOut[0] = in_buffer[0];
-                if(data.node->outArrayType == rocfft_array_type_complex_planar
-                   || data.node->outArrayType == rocfft_array_type_hermitian_planar)
-                {
-                    data.bufOut[1] = in_buffer[1];
-                }
-                break;
-            case OB_USER_OUT:
-                data.bufOut[0] = out_buffer[0];
-                if(data.node->outArrayType == rocfft_array_type_complex_planar
-                   || data.node->outArrayType == rocfft_array_type_hermitian_planar)
-                {
-                    data.bufOut[1] = out_buffer[1];
-                }
-                break;
-            case OB_TEMP:
-                data.bufOut[0] = info->workBuffer;
-                if(data.node->outArrayType == rocfft_array_type_complex_planar
-                   || data.node->outArrayType == rocfft_array_type_hermitian_planar)
-                {
-                    // assume planar using the same extra size of memory as
-                    // interleaved format, and we just need to split it for
-                    // planar.
-                    data.bufOut[1] = (void*)((char*)info->workBuffer
-                                             + execPlan.workBufSize * complexTSize / 2);
-                }
-                break;
-            case OB_TEMP_CMPLX_FOR_REAL:
-                data.bufOut[0]
-                    = (void*)((char*)info->workBuffer + execPlan.tmpWorkBufSize * complexTSize);
-                break;
-            case OB_TEMP_BLUESTEIN:
-                data.bufOut[0] = (void*)((char*)info->workBuffer
-                                         + (execPlan.tmpWorkBufSize + execPlan.copyWorkBufSize
-                                            + data.node->oOffset)
-                                               * complexTSize);
-                break;
-            default:
-                assert(false);
-            }
+            data.bufIn[j] = ResolveLaunchBuffer(entry.bufIn[j], in_buffer, out_buffer, work_buffer);
+            data.bufOut[j]
+                = ResolveLaunchBuffer(entry.bufOut[j], in_buffer, out_buffer, work_buffer);
         }
 
-        data.gridParam = execPlan.gridParam[i];
-
 #ifdef TMP_DEBUG
         //TODO:
         // - move the below into DeviceCallIn
@@ -626,7 +872,7 @@ void TransformPowX(const ExecPlan&       execPlan,
         rocfft_cout << "attempting kernel: " << i << std::endl;
 #endif
 
-        DevFnCall fn = execPlan.devFnCall[i];
+        DevFnCall fn = entry.fn;
         if(fn)
         {
 #ifdef REF_DEBUG
@@ -661,48 +907,32 @@ void TransformPowX(const ExecPlan&       execPlan,
 #endif
 
             // execution kernel:
-            if(emit_profile_log)
-                hipEventRecord(start);
+            hipEvent_t start, stop;
+            bool       profile_kernel
+                = emit_profile_log && KernelProfiler::GetProfiler().GetEvents(start, stop);
+            if(profile_kernel)
+                hipEventRecord(start, data.rocfft_stream);
             DeviceCallOut back;
             fn(&data, &back);
-            if(emit_profile_log)
-                hipEventRecord(stop);
-
-            // If we were on the null stream, measure elapsed time
-            // and emit profile logging.  If a stream was given, we
-            // can't wait for the transform to finish, so we can't
-            // emit any information.
-            if(emit_profile_log)
+            if(profile_kernel)
+                hipEventRecord(stop, data.rocfft_stream);
+            if(kernel_events)
+                hipEventRecord(kernel_events[i], data.rocfft_stream);
+
+            if(profile_kernel)
             {
-                hipEventSynchronize(stop);
                 size_t in_size_bytes = data_size_bytes(
                     data.node->length, data.node->precision, data.node->inArrayType);
                 size_t out_size_bytes = data_size_bytes(
                     data.node->length, data.node->precision, data.node->outArrayType);
                 size_t total_size_bytes = (in_size_bytes + out_size_bytes) * data.node->batch;
 
-                float duration_ms = 0.0f;
-                hipEventElapsedTime(&duration_ms, start, stop);
-                auto exec_bw        = execution_bandwidth_GB_per_s(total_size_bytes, duration_ms);
-                auto efficiency_pct = 0.0;
-                if(max_memory_bw != 0.0)
-                    efficiency_pct = 100.0 * exec_bw / max_memory_bw;
-                log_profile(__func__,
-                            "scheme",
-                            PrintScheme(execPlan.execSeq[i]->scheme),
-                            "duration_ms",
-                            duration_ms,
-                            "in_size",
-                            std::make_pair(static_cast<const size_t*>(data.node->length.data()),
-                                           data.node->length.size()),
-                            "total_size_bytes",
-                            total_size_bytes,
-                            "exec_GB_s",
-                            exec_bw,
-                            "max_mem_GB_s",
-                            max_memory_bw,
-                            "bw_efficiency_pct",
-                            efficiency_pct);
+                KernelProfiler::GetProfiler().Submit(start,
+                                                     stop,
+                                                     data.node->scheme,
+                                                     data.node->length,
+                                                     total_size_bytes,
+                                                     max_memory_bw);
             }
 
 #ifdef REF_DEBUG
@@ -776,9 +1006,4 @@ void TransformPowX(const ExecPlan&       execPlan,
         free(dbg_in);
 #endif
     }
-    if(emit_profile_log)
-    {
-        hipEventDestroy(start);
-        hipEventDestroy(stop);
-    }
 }
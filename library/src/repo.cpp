@@ -34,6 +34,65 @@
 std::mutex        Repo::mtx;
 std::atomic<bool> Repo::repoDestroyed(false);
 
+// Build the tree for a plan and enqueue its kernels.  If reuse is
+// given, device twiddles and kernel arguments of its matching nodes
+// are moved into the new plan instead of being created again, and are
+// moved back if planning fails.
+static rocfft_status BuildExecPlan(const rocfft_plan_t& plan, ExecPlan& execPlan, ExecPlan* reuse)
+{
+    auto rootPlan = TreeNode::CreateNode();
+
+    rootPlan->dimension = plan.rank;
+    rootPlan->batch     = plan.batch;
+    for(size_t i = 0; i < plan.rank; i++)
+    {
+        rootPlan->length.push_back(plan.lengths[i]);
+
+        rootPlan->inStride.push_back(plan.desc.inStrides[i]);
+        rootPlan->outStride.push_back(plan.desc.outStrides[i]);
+    }
+    rootPlan->iDist = plan.desc.inDist;
+    rootPlan->oDist = plan.desc.outDist;
+
+    rootPlan->placement = plan.placement;
+    rootPlan->precision = plan.precision;
+    if((plan.transformType == rocfft_transform_type_complex_forward)
+       || (plan.transformType == rocfft_transform_type_real_forward))
+        rootPlan->direction = -1;
+    else
+        rootPlan->direction = 1;
+
+    rootPlan->inArrayType  = plan.desc.inArrayType;
+    rootPlan->outArrayType = plan.desc.outArrayType;
+
+    execPlan.rootPlan = std::move(rootPlan);
+    ProcessNode(execPlan); // TODO: more descriptions are needed
+    if(LOG_TRACE_ENABLED())
+        PrintNode(*LogSingleton::GetInstance().GetTraceOS(), execPlan);
+
+    // per-batch pointers are resolved by the Stockham kernel, so
+    // the whole transform must be done by one such kernel
+    if(plan.desc.batchPointers)
+    {
+        if(execPlan.execSeq.size() != 1 || execPlan.execSeq.front()->scheme != CS_KERNEL_STOCKHAM)
+            return rocfft_status_invalid_dimensions;
+        execPlan.execSeq.front()->batchPointers = true;
+    }
+
+    if(reuse != nullptr)
+        MoveDeviceBuffers(*reuse, execPlan);
+
+    // PlanPowX enqueues the GPU kernels by function pointers but
+    // does not execute kernels
+    if(!PlanPowX(execPlan))
+    {
+        if(reuse != nullptr)
+            MoveDeviceBuffers(execPlan, *reuse);
+        return rocfft_status_failure;
+    }
+    return rocfft_status_success;
+}
+
 rocfft_status Repo::CreatePlan(rocfft_plan plan)
 {
     std::lock_guard<std::mutex> lck(mtx);
@@ -46,43 +105,10 @@ rocfft_status Repo::CreatePlan(rocfft_plan plan)
     auto it = repo.planUnique.find(*plan);
     if(it == repo.planUnique.end()) // if not found
     {
-        auto rootPlan = TreeNode::CreateNode();
-
-        rootPlan->dimension = plan->rank;
-        rootPlan->batch     = plan->batch;
-        for(size_t i = 0; i < plan->rank; i++)
-        {
-            rootPlan->length.push_back(plan->lengths[i]);
-
-            rootPlan->inStride.push_back(plan->desc.inStrides[i]);
-            rootPlan->outStride.push_back(plan->desc.outStrides[i]);
-        }
-        rootPlan->iDist = plan->desc.inDist;
-        rootPlan->oDist = plan->desc.outDist;
-
-        rootPlan->placement = plan->placement;
-        rootPlan->precision = plan->precision;
-        if((plan->transformType == rocfft_transform_type_complex_forward)
-           || (plan->transformType == rocfft_transform_type_real_forward))
-            rootPlan->direction = -1;
-        else
-            rootPlan->direction = 1;
-
-        rootPlan->inArrayType  = plan->desc.inArrayType;
-        rootPlan->outArrayType = plan->desc.outArrayType;
-
         ExecPlan execPlan;
-        execPlan.rootPlan = std::move(rootPlan);
-        ProcessNode(execPlan); // TODO: more descriptions are needed
-        if(LOG_TRACE_ENABLED())
-            PrintNode(*LogSingleton::GetInstance().GetTraceOS(), execPlan);
-
-        if(!PlanPowX(execPlan)) // PlanPowX enqueues the GPU kernels by function
-        {
-            return rocfft_status_failure;
-        }
-
-        // pointers but does not execute kernels
+        auto     status = BuildExecPlan(*plan, execPlan, nullptr);
+        if(status != rocfft_status_success)
+            return status;
 
         // add this plan into member planUnique (type of map)
         repo.planUnique[*plan] = std::make_pair(execPlan, 1);
@@ -98,6 +124,75 @@ rocfft_status Repo::CreatePlan(rocfft_plan plan)
 
     return rocfft_status_success;
 }
+
+// Change the batch count of a plan.  Other plans with the same
+// parameters share an ExecPlan, so the device buffers of the old
+// ExecPlan can only be taken over if no other plan refers to it.
+rocfft_status Repo::SetPlanBatch(rocfft_plan plan, size_t batch)
+{
+    std::lock_guard<std::mutex> lck(mtx);
+    if(repoDestroyed)
+        return rocfft_status_failure;
+
+    Repo& repo = Repo::GetRepo();
+
+    auto it_old = repo.planUnique.find(*plan);
+    if(it_old == repo.planUnique.end())
+        return rocfft_status_failure;
+    if(plan->batch == batch)
+        return rocfft_status_success;
+
+    rocfft_plan_t key = *plan;
+    key.batch         = batch;
+
+    // callbacks are kept with the plan's own copy of the ExecPlan
+    const UserCallbacks callbacks = repo.execLookup[plan].callbacks;
+
+    auto it = repo.planUnique.find(key);
+    if(it == repo.planUnique.end())
+    {
+        ExecPlan* reuse = (it_old->second.second == 1) ? &it_old->second.first : nullptr;
+        ExecPlan  execPlan;
+        auto      status = BuildExecPlan(key, execPlan, reuse);
+        if(status != rocfft_status_success)
+            return status;
+
+        repo.planUnique[key]  = std::make_pair(execPlan, 1);
+        repo.execLookup[plan] = execPlan;
+    }
+    else
+    {
+        repo.execLookup[plan] = it->second.first;
+        it->second.second++;
+    }
+
+    // release the reference to the old ExecPlan
+    it_old->second.second--;
+    if(it_old->second.second <= 0)
+        repo.planUnique.erase(it_old);
+
+    plan->batch = batch;
+    if(callbacks.load_fn != nullptr || callbacks.store_fn != nullptr)
+        return ::SetPlanCallbacks(repo.execLookup[plan], callbacks);
+    return rocfft_status_success;
+}
+
+// Set the user callbacks of a plan.  They only apply to this plan's
+// copy of the ExecPlan, not to other plans with the same parameters.
+rocfft_status Repo::SetPlanCallbacks(rocfft_plan plan, const UserCallbacks& callbacks)
+{
+    std::lock_guard<std::mutex> lck(mtx);
+    if(repoDestroyed)
+        return rocfft_status_failure;
+
+    Repo& repo = Repo::GetRepo();
+
+    auto it = repo.execLookup.find(plan);
+    if(it == repo.execLookup.end())
+        return rocfft_status_failure;
+    return ::SetPlanCallbacks(it->second, callbacks);
+}
+
 // According to input plan, return the corresponding execPlan
 void Repo::GetPlan(rocfft_plan plan, ExecPlan& execPlan)
 {
@@ -110,6 +205,26 @@ void Repo::GetPlan(rocfft_plan plan, ExecPlan& execPlan)
         execPlan = repo.execLookup[plan];
 }
 
+// Look up the execPlans for several plans at once
+void Repo::GetPlans(const rocfft_plan      plans[],
+                    size_t                 number_of_plans,
+                    std::vector<ExecPlan>& execPlans)
+{
+    execPlans.resize(number_of_plans);
+
+    std::lock_guard<std::mutex> lck(mtx);
+    if(repoDestroyed)
+        return;
+
+    Repo& repo = Repo::GetRepo();
+    for(size_t i = 0; i < number_of_plans; ++i)
+    {
+        auto it = repo.execLookup.find(plans[i]);
+        if(it != repo.execLookup.end())
+            execPlans[i] = it->second;
+    }
+}
+
 // Remove the plan from Repo and release its ExecPlan resources if it is the last reference
 void Repo::DeletePlan(rocfft_plan plan)
 {
@@ -20,16 +20,37 @@
 * THE SOFTWARE.
 *******************************************************************************/
 
+#include <algorithm>
 #include <cassert>
 #include <cstdlib>
 #include <iostream>
 #include <vector>
 
+#include "launch_graph.h"
 #include "logging.h"
 #include "plan.h"
 #include "repo.h"
 #include "rocfft.h"
 #include "transform.h"
+#include "work_buffer_pool.h"
+
+rocfft_execution_info_t::~rocfft_execution_info_t()
+{
+    for(auto event : eventPool)
+        hipEventDestroy(event);
+}
+
+bool rocfft_execution_info_t::ReserveEvents(size_t count)
+{
+    while(eventPool.size() < count)
+    {
+        hipEvent_t event;
+        if(hipEventCreateWithFlags(&event, hipEventDisableTiming) != hipSuccess)
+            return false;
+        eventPool.push_back(event);
+    }
+    return true;
+}
 
 rocfft_status rocfft_execution_info_create(rocfft_execution_info* info)
 {
@@ -70,6 +91,152 @@ rocfft_status rocfft_execution_info_set_stream(rocfft_execution_info info, void*
     return rocfft_status_success;
 }
 
+rocfft_status rocfft_execution_info_set_mode(rocfft_execution_info       info,
+                                             const rocfft_execution_mode mode)
+{
+    log_trace(__func__, "info", info, "mode", mode);
+    switch(mode)
+    {
+    case rocfft_exec_mode_nonblocking:
+    case rocfft_exec_mode_nonblocking_with_flush:
+    case rocfft_exec_mode_blocking:
+        info->mode = mode;
+        return rocfft_status_success;
+    }
+    return rocfft_status_invalid_arg_value;
+}
+
+rocfft_status rocfft_execution_info_set_kernel_events(rocfft_execution_info info, const int enable)
+{
+    log_trace(__func__, "info", info, "enable", enable);
+    info->kernelEvents = enable != 0;
+    return rocfft_status_success;
+}
+
+rocfft_status rocfft_execution_info_get_events(const rocfft_execution_info info,
+                                               void**                      events,
+                                               size_t*                     number_of_events)
+{
+    log_trace(__func__, "info", info, "events", events, "number_of_events", number_of_events);
+    if(!info || !number_of_events)
+        return rocfft_status_invalid_arg_value;
+
+    // with a null events array, just report how many there are
+    if(events)
+    {
+        for(size_t i = 0; i < info->numEvents; ++i)
+            events[i] = info->eventPool[i];
+    }
+    *number_of_events = info->numEvents;
+    return rocfft_status_success;
+}
+
+rocfft_status rocfft_execution_info_set_work_buffer_pool(rocfft_execution_info info,
+                                                        const int             enable)
+{
+    log_trace(__func__, "info", info, "enable", enable);
+    info->workBufferPool = enable != 0;
+    return rocfft_status_success;
+}
+
+rocfft_status rocfft_execution_info_set_launch_graph(rocfft_execution_info info, const int enable)
+{
+    log_trace(__func__, "info", info, "enable", enable);
+    info->launchGraph = enable != 0;
+    return rocfft_status_success;
+}
+
+rocfft_status ExecutePlans(const rocfft_plan     plans[],
+                           size_t                number_of_plans,
+                           void**                in_buffers[],
+                           void**                out_buffers[],
+                           rocfft_execution_info info)
+{
+    std::vector<ExecPlan> execPlans;
+    Repo::GetPlans(plans, number_of_plans, execPlans);
+
+    // the work buffer is only used by one plan at a time, so it only
+    // needs to be as big as the largest requirement
+    size_t work_buffer_size = 0;
+    size_t num_kernels      = 0;
+    for(size_t i = 0; i < number_of_plans; ++i)
+    {
+#if defined(DEBUG) && defined(DEBUG_PLAN_OUTPUT)
+        PrintNode(rocfft_cout, execPlans[i]);
+#endif
+        work_buffer_size
+            = std::max(work_buffer_size, execPlans[i].workBufSize * 2 * plans[i]->base_type_size);
+        num_kernels += execPlans[i].launchTable.size();
+    }
+
+    // take a work buffer from the pool if the user didn't give us a
+    // big enough one
+    void* work_buffer = info ? info->workBuffer : nullptr;
+    bool  pooled      = false;
+    if(work_buffer_size > 0 && (!info || info->workBufferSize < work_buffer_size))
+    {
+        if(!info || !info->workBufferPool)
+            return rocfft_status_invalid_work_buffer;
+        work_buffer = WorkBufferPool::GetPool().Acquire(info->rocfft_stream, work_buffer_size);
+        if(!work_buffer)
+            return rocfft_status_failure;
+        pooled = true;
+    }
+
+    // one event per kernel, where the last one also marks completion
+    // of the plans, or one event for all the plans
+    bool per_kernel_events = info && info->kernelEvents && num_kernels > 0;
+    if(info)
+    {
+        size_t numEvents = per_kernel_events ? num_kernels : 1;
+        if(!info->ReserveEvents(numEvents))
+        {
+            info->numEvents = 0;
+            if(pooled)
+                WorkBufferPool::GetPool().Release(work_buffer);
+            return rocfft_status_failure;
+        }
+        info->numEvents = numEvents;
+    }
+
+    hipEvent_t* kernel_events = per_kernel_events ? info->eventPool.data() : nullptr;
+    for(size_t i = 0; i < number_of_plans; ++i)
+    {
+        const ExecPlan& execPlan   = execPlans[i];
+        void**          in_buffer  = in_buffers[i];
+        void**          out_buffer = in_buffer;
+        if(plans[i]->placement != rocfft_placement_inplace)
+            out_buffer = out_buffers[i];
+
+        // per-kernel events need the kernels to be launched individually
+        if(kernel_events || !info || !info->launchGraph || !execPlan.launchGraphs
+           || !execPlan.launchGraphs->Launch(
+               execPlan, in_buffer, out_buffer, work_buffer, info->rocfft_stream))
+            TransformPowX(execPlan, in_buffer, out_buffer, work_buffer, info, kernel_events);
+
+        if(kernel_events)
+            kernel_events += execPlan.launchTable.size();
+    }
+
+    // the work is enqueued, so later work on the stream can reuse
+    // the buffer
+    if(pooled)
+        WorkBufferPool::GetPool().Release(work_buffer);
+
+    if(info)
+    {
+        hipEvent_t done = info->eventPool[info->numEvents - 1];
+        if(!per_kernel_events)
+            hipEventRecord(done, info->rocfft_stream);
+        // HIP submits work as it is launched, so there is nothing
+        // extra to flush for rocfft_exec_mode_nonblocking_with_flush
+        if(info->mode == rocfft_exec_mode_blocking)
+            hipEventSynchronize(done);
+    }
+
+    return rocfft_status_success;
+}
+
 rocfft_status rocfft_execute(const rocfft_plan     plan,
                              void*                 in_buffer[],
                              void*                 out_buffer[],
@@ -78,24 +245,38 @@ rocfft_status rocfft_execute(const rocfft_plan     plan,
     log_trace(
         __func__, "plan", plan, "in_buffer", in_buffer, "out_buffer", out_buffer, "info", info);
 
-    Repo&    repo = Repo::GetRepo();
-    ExecPlan execPlan;
-    repo.GetPlan(plan, execPlan);
+    return ExecutePlans(&plan, 1, &in_buffer, &out_buffer, info);
+}
 
-#if defined(DEBUG) && defined(DEBUG_PLAN_OUTPUT)
-    PrintNode(rocfft_cout, execPlan);
-#endif
+rocfft_status rocfft_execute_many(const rocfft_plan     plans[],
+                                  size_t                number_of_plans,
+                                  void**                in_buffers[],
+                                  void**                out_buffers[],
+                                  rocfft_execution_info info)
+{
+    log_trace(__func__,
+              "plans",
+              plans,
+              "number_of_plans",
+              number_of_plans,
+              "in_buffers",
+              in_buffers,
+              "out_buffers",
+              out_buffers,
+              "info",
+              info);
 
-    if(execPlan.workBufSize > 0)
+    if(!plans || !in_buffers)
+        return rocfft_status_invalid_arg_value;
+    for(size_t i = 0; i < number_of_plans; ++i)
     {
-        if(!info || info->workBufferSize < execPlan.workBufSize * 2 * plan->base_type_size)
-            return rocfft_status_invalid_work_buffer;
+        if(!plans[i])
+            return rocfft_status_invalid_arg_value;
+        if(plans[i]->placement == rocfft_placement_notinplace && !out_buffers)
+            return rocfft_status_invalid_arg_value;
     }
+    if(number_of_plans == 0)
+        return rocfft_status_success;
 
-    TransformPowX(execPlan,
-                  in_buffer,
-                  (plan->placement == rocfft_placement_inplace) ? in_buffer : out_buffer,
-                  info);
-
-    return rocfft_status_success;
+    return ExecutePlans(plans, number_of_plans, in_buffers, out_buffers, info);
 }
@@ -86,8 +86,10 @@ gpubuf twiddles_create(size_t N, rocfft_precision precision, bool large, bool no
     }
 }
 
+// NR is the length of an optional table for real post/pre-processing,
+// appended after the tables for each dimension
 template <typename T>
-gpubuf twiddles_create_2D_pr(size_t N1, size_t N2)
+gpubuf twiddles_create_2D_pr(size_t N1, size_t N2, size_t NR = 0)
 {
     // create just one twiddle table if we can get away with it
     if(N1 == N2)
@@ -96,6 +98,7 @@ gpubuf twiddles_create_2D_pr(size_t N1, size_t N2)
 
     TwiddleTable<T> twTable1(N1);
     TwiddleTable<T> twTable2(N2);
+    TwiddleTable<T> twTableR(NR);
     // generate twiddles for each dimension separately
     radices    = GetRadices(N1);
     auto twtc1 = twTable1.GenerateTwiddleTable(radices);
@@ -105,15 +108,20 @@ gpubuf twiddles_create_2D_pr(size_t N1, size_t N2)
         radices = GetRadices(N2);
         twtc2   = twTable2.GenerateTwiddleTable(radices);
     }
+    T* twtcR = nullptr;
+    if(NR)
+        twtcR = twTableR.GenerateTwiddleTable();
 
-    // glue those two twiddle tables together in one malloc that we
-    // give to the kernel
+    // glue the twiddle tables together in one malloc that we give
+    // to the kernel
     gpubuf twts;
-    if(twts.alloc((N1 + N2) * sizeof(T)) != hipSuccess)
+    if(twts.alloc((N1 + N2 + NR) * sizeof(T)) != hipSuccess)
         return twts;
     auto twts_ptr = static_cast<T*>(twts.data());
     if(hipMemcpy(twts_ptr, twtc1, N1 * sizeof(T), hipMemcpyHostToDevice) != hipSuccess
-       || hipMemcpy(twts_ptr + N1, twtc2, N2 * sizeof(T), hipMemcpyHostToDevice) != hipSuccess)
+       || hipMemcpy(twts_ptr + N1, twtc2, N2 * sizeof(T), hipMemcpyHostToDevice) != hipSuccess
+       || hipMemcpy(twts_ptr + N1 + N2, twtcR, NR * sizeof(T), hipMemcpyHostToDevice)
+              != hipSuccess)
         twts.free();
     return twts;
 }
@@ -130,3 +138,17 @@ gpubuf twiddles_create_2D(size_t N1, size_t N2, rocfft_precision precision)
         return {};
     }
 }
+
+gpubuf twiddles_create_2D_real(size_t N0, size_t N1, rocfft_precision precision)
+{
+    // rows are transformed as half-length complex sequences
+    if(precision == rocfft_precision_single)
+        return twiddles_create_2D_pr<float2>(N0 / 2, N1, N0);
+    else if(precision == rocfft_precision_double)
+        return twiddles_create_2D_pr<double2>(N0 / 2, N1, N0);
+    else
+    {
+        assert(false);
+        return {};
+    }
+}
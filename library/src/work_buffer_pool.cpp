@@ -0,0 +1,149 @@
+/******************************************************************************
+* Copyright (c) 2016 - present Advanced Micro Devices, Inc. All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*******************************************************************************/
+
+#include <algorithm>
+
+#include "work_buffer_pool.h"
+#include "logging.h"
+#include "rocfft.h"
+
+// Round allocations up to this size, so that plans with similar work
+// buffer requirements can share blocks
+static const size_t WORK_BUFFER_POOL_GRANULARITY = 1 << 20;
+
+void* WorkBufferPool::Acquire(hipStream_t stream, size_t size)
+{
+    int device = 0;
+    if(hipGetDevice(&device) != hipSuccess)
+        return nullptr;
+
+    std::lock_guard<std::mutex> lck(mtx);
+
+    // reuse the smallest free block that's big enough
+    Block* best = nullptr;
+    for(auto& block : blocks)
+    {
+        if(block.acquired || block.device != device || block.stream != stream
+           || block.size < size)
+            continue;
+        if(!best || block.size < best->size)
+            best = &block;
+    }
+    if(best)
+    {
+        // order the new work after the work that released the block,
+        // in case the stream handle now belongs to a different stream
+        if(best->event && hipStreamWaitEvent(stream, best->event, 0) != hipSuccess)
+            return nullptr;
+        best->acquired = true;
+        return best->buf;
+    }
+
+    size_t alloc_size = (size + WORK_BUFFER_POOL_GRANULARITY - 1) / WORK_BUFFER_POOL_GRANULARITY
+                        * WORK_BUFFER_POOL_GRANULARITY;
+    void*  buf        = nullptr;
+    if(hipMalloc(&buf, alloc_size) != hipSuccess)
+    {
+        // give back whatever we're caching and try once more
+        TrimLocked();
+        if(hipMalloc(&buf, alloc_size) != hipSuccess)
+            return nullptr;
+    }
+    blocks.push_back({device, stream, buf, alloc_size, true, nullptr});
+    poolBytes += alloc_size;
+    highWaterBytes = std::max(highWaterBytes, poolBytes);
+    return buf;
+}
+
+void WorkBufferPool::Release(void* buf)
+{
+    std::lock_guard<std::mutex> lck(mtx);
+    for(auto it = blocks.begin(); it != blocks.end(); ++it)
+    {
+        if(it->buf != buf)
+            continue;
+
+        it->acquired = false;
+        if((it->event || hipEventCreateWithFlags(&it->event, hipEventDisableTiming) == hipSuccess)
+           && hipEventRecord(it->event, it->stream) == hipSuccess)
+            return;
+
+        // without an event, later work can't be ordered after the
+        // work using the block, so give the block back instead
+        FreeBlock(*it);
+        blocks.erase(it);
+        return;
+    }
+}
+
+void WorkBufferPool::Trim()
+{
+    std::lock_guard<std::mutex> lck(mtx);
+    TrimLocked();
+}
+
+void WorkBufferPool::TrimLocked()
+{
+    // hipFree waits for outstanding work on the device, so blocks
+    // can be freed even if kernels using them are still running
+    for(auto it = blocks.begin(); it != blocks.end();)
+    {
+        if(it->acquired)
+        {
+            ++it;
+            continue;
+        }
+        FreeBlock(*it);
+        it = blocks.erase(it);
+    }
+}
+
+void WorkBufferPool::FreeBlock(Block& block)
+{
+    if(block.event)
+        hipEventDestroy(block.event);
+    hipFree(block.buf);
+    poolBytes -= block.size;
+}
+
+void WorkBufferPool::GetUsage(size_t& pool_bytes, size_t& high_water_bytes)
+{
+    std::lock_guard<std::mutex> lck(mtx);
+    pool_bytes       = poolBytes;
+    high_water_bytes = highWaterBytes;
+}
+
+rocfft_status rocfft_work_buffer_pool_trim()
+{
+    log_trace(__func__);
+    WorkBufferPool::GetPool().Trim();
+    return rocfft_status_success;
+}
+
+rocfft_status rocfft_work_buffer_pool_get_usage(size_t* pool_bytes, size_t* high_water_bytes)
+{
+    log_trace(__func__, "pool_bytes", pool_bytes, "high_water_bytes", high_water_bytes);
+    if(!pool_bytes || !high_water_bytes)
+        return rocfft_status_invalid_arg_value;
+    WorkBufferPool::GetPool().GetUsage(*pool_bytes, *high_water_bytes);
+    return rocfft_status_success;
+}